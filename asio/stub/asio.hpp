@@ -46,6 +46,7 @@ struct dummy_base
     {
     }
     void set_option(const dummy_base &) const {};
+    void set_option(const dummy_base &, const dummy_base &) const {};
 };
 inline bool write(const dummy_base &, const dummy_base &, const dummy_base &)
 {
@@ -55,6 +56,12 @@ inline bool read(const dummy_base &, const dummy_base &, const dummy_base &)
 {
     return true;
 }
+inline void async_write(const dummy_base &, const dummy_base &, const dummy_base &)
+{
+}
+inline void async_read(const dummy_base &, const dummy_base &, const dummy_base &)
+{
+}
 using buffer = dummy_base;
 struct io_service : dummy_base
 {
@@ -75,6 +82,7 @@ struct socket_base : dummy_base
 
     using linger = dummy_base;
     using enable_connection_aborted = dummy_base;
+    void connect(const dummy_base &, const dummy_base &) const {};
     void close() const {};
 };
 
@@ -87,6 +95,7 @@ struct error_code : dummy_base, std::error_code
 namespace error
 {
 static const error_code eof{};
+static const error_code connection_refused{};
 }
 
 namespace ip
@@ -114,4 +123,25 @@ struct acceptor : dummy_base
 };
 }
 }
+
+namespace generic
+{
+struct stream_protocol
+{
+    using socket = socket_base;
+    using endpoint = ip::tcp::endpoint;
+};
+}
+template <class Protocol>
+using basic_socket_acceptor = ip::tcp::acceptor;
+
+#define ASIO_HAS_LOCAL_SOCKETS
+namespace local
+{
+struct stream_protocol
+{
+    using socket = socket_base;
+    using endpoint = ip::tcp::endpoint;
+};
+}
 }
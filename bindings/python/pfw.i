@@ -103,6 +103,21 @@ public:
     bool setValidateSchemasOnStart(bool bValidate, std::string &strError);
     bool getValidateSchemasOnStart() const;
 
+    bool setParallelApply(bool bParallel, std::string &strError);
+    bool getParallelApply() const;
+
+    bool setDecisionTable(bool bDecisionTable, std::string &strError);
+    bool getDecisionTable() const;
+
+    bool setSettingsDeduplication(bool bDeduplicate, std::string &strError);
+    bool getSettingsDeduplication() const;
+
+    bool setSettingsCacheLocation(const std::string &strLocation, std::string &strError);
+    std::string getSettingsCacheLocation() const;
+
+    bool setAsynchronousSync(bool bAsynchronous, std::string &strError);
+    bool getAsynchronousSync() const;
+
     // Tuning mode
     bool setTuningMode(bool bOn, std::string& strError);
     bool isTuningModeOn() const;
@@ -30,6 +30,7 @@
 #include "AreaConfiguration.h"
 #include "ConfigurableElement.h"
 #include "ConfigurationAccessContext.h"
+#include "BinaryStream.h"
 #include <assert.h>
 
 CAreaConfiguration::CAreaConfiguration(const CConfigurableElement *pConfigurableElement,
@@ -63,7 +64,37 @@ bool CAreaConfiguration::restore(CParameterBlackboard *pMainBlackboard, bool bSy
     copyTo(pMainBlackboard, _pConfigurableElement->getOffset());
 
     // Synchronize if required
-    return !bSync || _pSyncerSet->sync(*pMainBlackboard, false, errors);
+    return !bSync || sync(pMainBlackboard, errors);
+}
+
+bool CAreaConfiguration::sync(CParameterBlackboard *pMainBlackboard, core::Results *errors) const
+{
+    return _pSyncerSet->sync(*pMainBlackboard, false, errors);
+}
+
+bool CAreaConfiguration::isRestoredAsIs() const
+{
+    return true;
+}
+
+bool CAreaConfiguration::restoreDifferences(CParameterBlackboard *pMainBlackboard,
+                                            CSyncerSet &syncerSet) const
+{
+    assert(_bValid);
+
+    size_t offset = _pConfigurableElement->getOffset();
+
+    if (matches(pMainBlackboard, offset) &&
+        !pMainBlackboard->isDirty(offset, _blackboard.getSize())) {
+
+        return false;
+    }
+
+    copyTo(pMainBlackboard, offset);
+
+    syncerSet += *_pSyncerSet;
+
+    return true;
 }
 
 // Ensure validity
@@ -128,6 +159,44 @@ bool CAreaConfiguration::serializeXmlSettings(
     return false;
 }
 
+// Binary settings serializing
+void CAreaConfiguration::binarySerialize(CBinaryStream &binaryStream) const
+{
+    binaryStream.writeInteger<uint8_t>(_bValid);
+
+    // Invalid areas are validated once loaded, their content is meaningless
+    if (_bValid) {
+
+        std::vector<uint8_t> settings(_blackboard.getSize());
+        _blackboard.readBytes(settings, 0);
+
+        binaryStream.writeBytes(settings);
+    }
+}
+
+bool CAreaConfiguration::binaryDeserialize(CBinaryStream &binaryStream)
+{
+    uint8_t valid;
+
+    if (!binaryStream.readInteger(valid)) {
+
+        return false;
+    }
+    if (valid) {
+
+        std::vector<uint8_t> settings;
+
+        if (!binaryStream.readBytes(settings) || settings.size() != _blackboard.getSize()) {
+
+            return false;
+        }
+        _blackboard.writeBytes(settings, 0);
+    }
+    _bValid = valid != 0;
+
+    return true;
+}
+
 // Compound handling
 const CConfigurableElement *CAreaConfiguration::getConfigurableElement() const
 {
@@ -181,3 +250,9 @@ void CAreaConfiguration::copyFrom(const CParameterBlackboard *pFromBlackboard, s
 {
     pFromBlackboard->saveTo(&_blackboard, offset);
 }
+
+// Blackboard comparison
+bool CAreaConfiguration::matches(const CParameterBlackboard *pBlackboard, size_t offset) const
+{
+    return pBlackboard->matches(&_blackboard, offset);
+}
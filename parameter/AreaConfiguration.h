@@ -36,6 +36,7 @@
 class CConfigurableElement;
 class CXmlElement;
 class CConfigurationAccessContext;
+class CBinaryStream;
 
 class CAreaConfiguration
 {
@@ -57,6 +58,29 @@ public:
      */
     bool restore(CParameterBlackboard *pMainBlackboard, bool bSync, core::Results *errors) const;
 
+    /** Synchronize the configuration area, once restored
+     *
+     * @param[in] pMainBlackboard the application main blackboard
+     * @param[out] errors, errors encountered during synchronization
+     * @return true if success false otherwise
+     */
+    bool sync(CParameterBlackboard *pMainBlackboard, core::Results *errors) const;
+
+    /** @return true if restoration copies the area blackboard as is at the element offset,
+     * so that adjacent areas may be restored at once */
+    virtual bool isRestoredAsIs() const;
+
+    /** Restore the configuration area if it differs from the main blackboard
+     *
+     * Areas matching the main blackboard content and not pending synchronization are neither
+     * copied nor contributed to the syncer set.
+     *
+     * @param[in] pMainBlackboard the application main blackboard
+     * @param[in,out] syncerSet set the area syncers are added to when restored
+     * @return true if the area has been restored, false if skipped
+     */
+    bool restoreDifferences(CParameterBlackboard *pMainBlackboard, CSyncerSet &syncerSet) const;
+
     // Ensure validity
     void validate(const CParameterBlackboard *pMainBlackboard);
 
@@ -79,6 +103,10 @@ public:
     bool serializeXmlSettings(CXmlElement &xmlConfigurableElementSettingsElementContent,
                               CConfigurationAccessContext &configurationAccessContext);
 
+    // Binary settings serializing
+    void binarySerialize(CBinaryStream &binaryStream) const;
+    bool binaryDeserialize(CBinaryStream &binaryStream);
+
     // Fetch the Configuration Blackboard
     CParameterBlackboard &getBlackboard();
     const CParameterBlackboard &getBlackboard() const;
@@ -92,6 +120,9 @@ private:
     virtual void copyTo(CParameterBlackboard *pToBlackboard, size_t offset) const;
     virtual void copyFrom(const CParameterBlackboard *pFromBlackboard, size_t offset);
 
+    // Blackboard comparison, true if copyTo would leave the blackboard unchanged
+    virtual bool matches(const CParameterBlackboard *pBlackboard, size_t offset) const;
+
     // Store validity
     void setValid(bool bValid);
 
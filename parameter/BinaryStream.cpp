@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "BinaryStream.h"
+#include <algorithm>
+#include <utility>
+
+CBinaryStream::CBinaryStream(std::vector<uint8_t> data) : mData(std::move(data))
+{
+}
+
+void CBinaryStream::write(const void *pvData, size_t size)
+{
+    const uint8_t *first = static_cast<const uint8_t *>(pvData);
+
+    mData.insert(end(mData), first, first + size);
+}
+
+bool CBinaryStream::read(void *pvData, size_t size)
+{
+    if (size > mData.size() - mOffset) {
+
+        return false;
+    }
+    std::copy_n(begin(mData) + mOffset, size, static_cast<uint8_t *>(pvData));
+    mOffset += size;
+
+    return true;
+}
+
+void CBinaryStream::writeString(const std::string &value)
+{
+    writeInteger(static_cast<uint32_t>(value.size()));
+    write(value.data(), value.size());
+}
+
+bool CBinaryStream::readString(std::string &value)
+{
+    uint32_t size;
+
+    if (!readInteger(size) || size > mData.size() - mOffset) {
+
+        return false;
+    }
+    value.assign(reinterpret_cast<const char *>(&mData[mOffset]), size);
+    mOffset += size;
+
+    return true;
+}
+
+void CBinaryStream::writeBytes(const std::vector<uint8_t> &bytes)
+{
+    writeInteger(static_cast<uint32_t>(bytes.size()));
+    write(bytes.data(), bytes.size());
+}
+
+bool CBinaryStream::readBytes(std::vector<uint8_t> &bytes)
+{
+    uint32_t size;
+
+    if (!readInteger(size) || size > mData.size() - mOffset) {
+
+        return false;
+    }
+    bytes.assign(begin(mData) + mOffset, begin(mData) + mOffset + size);
+    mOffset += size;
+
+    return true;
+}
+
+bool CBinaryStream::atEnd() const
+{
+    return mOffset == mData.size();
+}
+
+const std::vector<uint8_t> &CBinaryStream::getData() const
+{
+    return mData;
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "NonCopyable.hpp"
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/** In-memory binary serialization stream
+ *
+ * Output streams accumulate written data, input streams read back data provided at construction.
+ * Integers are stored with the host byte order: streams are meant to be read back by the same
+ * platform, not exchanged.
+ */
+class CBinaryStream : private utility::NonCopyable
+{
+public:
+    /** Create an output stream */
+    CBinaryStream() = default;
+
+    /** Create an input stream
+     *
+     * @param[in] data the data to read from
+     */
+    CBinaryStream(std::vector<uint8_t> data);
+
+    void write(const void *pvData, size_t size);
+
+    /** @return false if fewer than size bytes are left to read, true otherwise */
+    bool read(void *pvData, size_t size);
+
+    template <typename T>
+    void writeInteger(T value)
+    {
+        static_assert(std::is_integral<T>::value, "Integral type expected");
+        write(&value, sizeof(value));
+    }
+
+    template <typename T>
+    bool readInteger(T &value)
+    {
+        static_assert(std::is_integral<T>::value, "Integral type expected");
+        return read(&value, sizeof(value));
+    }
+
+    // Length prefixed strings and byte vectors
+    void writeString(const std::string &value);
+    bool readString(std::string &value);
+    void writeBytes(const std::vector<uint8_t> &bytes);
+    bool readBytes(std::vector<uint8_t> &bytes);
+
+    /** @return true if all data has been read */
+    bool atEnd() const;
+
+    /** @return the written data */
+    const std::vector<uint8_t> &getData() const;
+
+private:
+    std::vector<uint8_t> mData;
+
+    /** Reading position */
+    size_t mOffset{0};
+};
@@ -40,6 +40,11 @@ CBitwiseAreaConfiguration::CBitwiseAreaConfiguration(
 {
 }
 
+bool CBitwiseAreaConfiguration::isRestoredAsIs() const
+{
+    return false;
+}
+
 // Blackboard copies
 void CBitwiseAreaConfiguration::copyTo(CParameterBlackboard *pToBlackboard, size_t offset) const
 {
@@ -86,3 +91,21 @@ void CBitwiseAreaConfiguration::copyFrom(const CParameterBlackboard *pFromBlackb
     // Write dst blackboard
     _blackboard.writeInteger(&uiDstData, pBitParameter->getBelongingBlockSize(), 0);
 }
+
+// Blackboard comparison
+bool CBitwiseAreaConfiguration::matches(const CParameterBlackboard *pBlackboard,
+                                        size_t offset) const
+{
+    // Beware this code works on little endian architectures only!
+    const CBitParameter *pBitParameter = static_cast<const CBitParameter *>(_pConfigurableElement);
+
+    uint64_t uiSrcData = 0;
+    uint64_t uiDstData = 0;
+
+    // Read blackboards
+    pBlackboard->readInteger(&uiDstData, pBitParameter->getBelongingBlockSize(), offset);
+    _blackboard.readInteger(&uiSrcData, pBitParameter->getBelongingBlockSize(), 0);
+
+    // Would merging change anything?
+    return pBitParameter->merge(uiDstData, uiSrcData) == uiDstData;
+}
@@ -39,8 +39,14 @@ public:
     CBitwiseAreaConfiguration(const CConfigurableElement *pConfigurableElement,
                               const CSyncerSet *pSyncerSet);
 
+    // Bits are merged into the belonging block
+    bool isRestoredAsIs() const override;
+
 private:
     // Blackboard copies
     void copyTo(CParameterBlackboard *pToBlackboard, size_t offset) const override;
     void copyFrom(const CParameterBlackboard *pFromBlackboard, size_t offset) override;
+
+    // Blackboard comparison
+    bool matches(const CParameterBlackboard *pBlackboard, size_t offset) const override;
 };
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "BlackboardStore.h"
+#include "Utility.h"
+
+void CBlackboardStore::share(CParameterBlackboard &blackboard)
+{
+    if (blackboard.getSize() == 0) {
+
+        // Nothing to deduplicate
+        return;
+    }
+    const CParameterBlackboard::SharedStorage &sharedStorage = blackboard.getSharedStorage();
+
+    std::vector<uint8_t> bytes(blackboard.getSize());
+    blackboard.readBytes(bytes, 0);
+
+    uint64_t key = utility::digest(bytes.data(), bytes.size());
+    auto range = mStorages.equal_range(key);
+
+    for (auto it = range.first; it != range.second; ++it) {
+
+        // Guard against hash collisions
+        if (*it->second == bytes) {
+
+            if (it->second != sharedStorage) {
+
+                blackboard.share(it->second);
+            }
+            return;
+        }
+    }
+    // First occurrence of this content
+    if (sharedStorage != nullptr) {
+
+        mStorages.emplace(key, sharedStorage);
+        return;
+    }
+    auto storage = std::make_shared<const std::vector<uint8_t>>(std::move(bytes));
+    mStorages.emplace(key, storage);
+
+    blackboard.share(storage);
+}
+
+void CBlackboardUsage::account(const CParameterBlackboard &blackboard)
+{
+    mContentSize += blackboard.getSize();
+
+    const std::vector<uint8_t> *sharedStorage = blackboard.getSharedStorage().get();
+
+    if (sharedStorage == nullptr || mSharedStorages.insert(sharedStorage).second) {
+
+        mStorageSize += blackboard.getSize();
+    }
+}
+
+size_t CBlackboardUsage::getContentSize() const
+{
+    return mContentSize;
+}
+
+size_t CBlackboardUsage::getStorageSize() const
+{
+    return mStorageSize;
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "ParameterBlackboard.h"
+#include "NonCopyable.hpp"
+
+#include <cstdint>
+#include <set>
+#include <unordered_map>
+
+/** Content-addressed store of configuration settings
+ *
+ * Blackboards handed to the store share a single immutable storage with all previously handed
+ * blackboards of identical content, so that settings repeated across configurations are held in
+ * memory once. Shared blackboards copy their content back on first modification.
+ */
+class CBlackboardStore : private utility::NonCopyable
+{
+public:
+    /** Share the blackboard storage with identical previously stored ones, if any
+     *
+     * Already shared storage is itself stored, so that deduplication can be resumed by another
+     * store instance.
+     *
+     * @param[in,out] blackboard the blackboard whose content is to be deduplicated
+     */
+    void share(CParameterBlackboard &blackboard);
+
+private:
+    /** Stored contents, by hash */
+    std::unordered_multimap<uint64_t, CParameterBlackboard::SharedStorage> mStorages;
+};
+
+/** Memory used by blackboards, accounting each shared storage once */
+class CBlackboardUsage
+{
+public:
+    /** Account for a blackboard
+     *
+     * @param[in] blackboard the blackboard to account for
+     */
+    void account(const CParameterBlackboard &blackboard);
+
+    /** @return the cumulated size of blackboard contents */
+    size_t getContentSize() const;
+
+    /** @return the memory actually holding blackboard contents */
+    size_t getStorageSize() const;
+
+private:
+    size_t mContentSize{0};
+    size_t mStorageSize{0};
+
+    /** Shared storages already accounted for */
+    std::set<const std::vector<uint8_t> *> mSharedStorages;
+};
@@ -125,6 +125,58 @@ bool CCompoundRule::matches() const
     return _bTypeAll;
 }
 
+// Criteria dependency
+void CCompoundRule::gatherCriteria(std::set<const CSelectionCriterion *> &criteria) const
+{
+    size_t uiNbChildren = getNbChildren();
+
+    for (size_t uiChild = 0; uiChild < uiNbChildren; uiChild++) {
+
+        const CRule *pRule = static_cast<const CRule *>(getChild(uiChild));
+
+        pRule->gatherCriteria(criteria);
+    }
+}
+
+// Compilation
+void CCompoundRule::compile(CRuleProgram &program, CRuleProgram::Label onMatch,
+                            CRuleProgram::Label onMismatch) const
+{
+    size_t uiNbChildren = getNbChildren();
+
+    if (!uiNbChildren) {
+
+        // Empty "All" always matches, empty "Any" never does
+        program.addJump(_bTypeAll ? onMatch : onMismatch);
+
+        return;
+    }
+
+    for (size_t uiChild = 0; uiChild < uiNbChildren; uiChild++) {
+
+        const CRule *pRule = static_cast<const CRule *>(getChild(uiChild));
+
+        if (uiChild == uiNbChildren - 1) {
+
+            // Last inner rule decides for the whole compound rule
+            pRule->compile(program, onMatch, onMismatch);
+
+            break;
+        }
+        // Otherwise, short-circuit or continue with next inner rule
+        CRuleProgram::Label next = program.createLabel();
+
+        if (_bTypeAll) {
+
+            pRule->compile(program, next, onMismatch);
+        } else {
+
+            pRule->compile(program, onMatch, next);
+        }
+        program.placeLabel(next);
+    }
+}
+
 // From IXmlSink
 bool CCompoundRule::fromXml(const CXmlElement &xmlElement,
                             CXmlSerializingContext &serializingContext)
@@ -45,6 +45,13 @@ public:
     // Rule check
     bool matches() const override;
 
+    // Criteria dependency
+    void gatherCriteria(std::set<const CSelectionCriterion *> &criteria) const override;
+
+    // Compilation
+    void compile(CRuleProgram &program, CRuleProgram::Label onMatch,
+                 CRuleProgram::Label onMismatch) const override;
+
     // From IXmlSink
     bool fromXml(const CXmlElement &xmlElement,
                  CXmlSerializingContext &serializingContext) override;
@@ -34,8 +34,10 @@
 #include "XmlDomainSerializingContext.h"
 #include "XmlDomainImportContext.h"
 #include "XmlDomainExportContext.h"
+#include "SelectionCriterion.h"
 #include "Utility.h"
 #include "AlwaysAssert.hpp"
+#include "BinaryStream.h"
 #include <cassert>
 
 #define base CElement
@@ -226,6 +228,8 @@ bool CConfigurableDomain::fromXml(const CXmlElement &xmlElement,
 
         return false;
     }
+    // Settings parsing has set the final element sequence
+    packAreaConfigurations();
 
     // All provided configurations are parsed
     // Attempt validation on areas of non provided configurations for all configurable elements if
@@ -238,6 +242,126 @@ bool CConfigurableDomain::fromXml(const CXmlElement &xmlElement,
     return true;
 }
 
+// Binary serializing
+void CConfigurableDomain::binarySerialize(CBinaryStream &binaryStream) const
+{
+    binaryStream.writeString(getName());
+    binaryStream.writeInteger<uint8_t>(_bSequenceAware);
+
+    // Configurations
+    size_t uiNbConfigurations = getNbChildren();
+    binaryStream.writeInteger(static_cast<uint32_t>(uiNbConfigurations));
+
+    for (size_t uiChild = 0; uiChild < uiNbConfigurations; uiChild++) {
+
+        binaryStream.writeString(getChild(uiChild)->getName());
+    }
+
+    // Configurable elements
+    binaryStream.writeInteger(static_cast<uint32_t>(_configurableElementList.size()));
+
+    for (const CConfigurableElement *pConfigurableElement : _configurableElementList) {
+
+        binaryStream.writeString(pConfigurableElement->getPath());
+        binaryStream.writeInteger<uint64_t>(pConfigurableElement->getFootPrint());
+    }
+
+    // Settings
+    for (size_t uiChild = 0; uiChild < uiNbConfigurations; uiChild++) {
+
+        static_cast<const CDomainConfiguration *>(getChild(uiChild))
+            ->binarySerialize(binaryStream);
+    }
+}
+
+bool CConfigurableDomain::binaryDeserialize(
+    CBinaryStream &binaryStream, CSystemClass &systemClass,
+    const CSelectionCriteriaDefinition *pSelectionCriteriaDefinition, string &strError)
+{
+    // We're supposedly clean
+    assert(_configurableElementList.empty());
+
+    string name;
+    uint8_t sequenceAware;
+    uint32_t nbConfigurations;
+
+    if (!binaryStream.readString(name) || !binaryStream.readInteger(sequenceAware) ||
+        !binaryStream.readInteger(nbConfigurations)) {
+
+        strError = "Truncated configurable domain";
+        return false;
+    }
+    setName(name);
+    _bSequenceAware = sequenceAware != 0;
+
+    // Configurations
+    for (uint32_t configuration = 0; configuration < nbConfigurations; ++configuration) {
+
+        string configurationName;
+
+        if (!binaryStream.readString(configurationName)) {
+
+            strError = "Truncated configurable domain " + getName();
+            return false;
+        }
+        addChild(new CDomainConfiguration(configurationName));
+    }
+
+    // Configurable elements
+    uint32_t nbConfigurableElements;
+
+    if (!binaryStream.readInteger(nbConfigurableElements)) {
+
+        strError = "Truncated configurable domain " + getName();
+        return false;
+    }
+    for (uint32_t element = 0; element < nbConfigurableElements; ++element) {
+
+        string strConfigurableElementPath;
+        uint64_t footPrint;
+
+        if (!binaryStream.readString(strConfigurableElementPath) ||
+            !binaryStream.readInteger(footPrint)) {
+
+            strError = "Truncated configurable domain " + getName();
+            return false;
+        }
+        CPathNavigator pathNavigator(strConfigurableElementPath);
+
+        CConfigurableElement *pConfigurableElement =
+            pathNavigator.navigateThrough(systemClass.getName(), strError)
+                ? static_cast<CConfigurableElement *>(systemClass.findDescendant(pathNavigator))
+                : nullptr;
+
+        if (!pConfigurableElement || pConfigurableElement->getFootPrint() != footPrint) {
+
+            strError = "Configurable element " + strConfigurableElementPath + " of domain " +
+                       getName() + " not found or changed";
+            return false;
+        }
+        core::Results infos;
+        if (!addConfigurableElement(pConfigurableElement, nullptr, infos)) {
+
+            strError = utility::asString(infos);
+            return false;
+        }
+    }
+
+    // Settings
+    for (uint32_t configuration = 0; configuration < nbConfigurations; ++configuration) {
+
+        if (!static_cast<CDomainConfiguration *>(getChild(configuration))
+                 ->binaryDeserialize(binaryStream, pSelectionCriteriaDefinition, strError)) {
+
+            return false;
+        }
+    }
+    packAreaConfigurations();
+    invalidateDecisionTable();
+
+    return true;
+}
+
 // XML parsing
 bool CConfigurableDomain::parseDomainConfigurations(const CXmlElement &xmlElement,
                                                     CXmlDomainImportContext &serializingContext)
@@ -251,7 +375,24 @@ bool CConfigurableDomain::parseDomainConfigurations(const CXmlElement &xmlElemen
     xmlElement.getChildElement("Configurations", xmlConfigurationsElement);
 
     // Parse it and create domain configuration objects
-    return base::fromXml(xmlConfigurationsElement, serializingContext);
+    if (!base::fromXml(xmlConfigurationsElement, serializingContext)) {
+
+        return false;
+    }
+
+    // Compile parsed application rules
+    size_t uiNbConfigurations = getNbChildren();
+
+    for (size_t uiChild = 0; uiChild < uiNbConfigurations; uiChild++) {
+
+        CDomainConfiguration *pDomainConfiguration =
+            static_cast<CDomainConfiguration *>(getChild(uiChild));
+
+        pDomainConfiguration->compileApplicationRule();
+    }
+    invalidateDecisionTable();
+
+    return true;
 }
 
 // Parse configurable elements
@@ -515,6 +656,8 @@ bool CConfigurableDomain::split(CConfigurableElement *pConfigurableElement, core
     // should include the syncers of its children elements
     doRemoveConfigurableElement(pConfigurableElement, false);
 
+    packAreaConfigurations();
+
     return true;
 }
 
@@ -540,7 +683,7 @@ const CDomainConfiguration *CConfigurableDomain::getPendingConfiguration() const
 
 // Configuration application if required
 void CConfigurableDomain::apply(CParameterBlackboard *pParameterBlackboard, CSyncerSet *pSyncerSet,
-                                bool bForce, std::string &strInfo) const
+                                bool bForce, bool bDecisionTable, std::string *pInfo) const
 {
     // Apply configuration only if the blackboard will
     // be synchronized either now or by syncerSet.
@@ -554,7 +697,8 @@ void CConfigurableDomain::apply(CParameterBlackboard *pParameterBlackboard, CSyn
         _pLastAppliedConfiguration = nullptr;
     }
     const CDomainConfiguration *pApplicableDomainConfiguration =
-        findApplicableDomainConfiguration();
+        bDecisionTable ? findMemorizedApplicableDomainConfiguration()
+                       : findApplicableDomainConfiguration();
 
     if (pApplicableDomainConfiguration) {
 
@@ -562,25 +706,82 @@ void CConfigurableDomain::apply(CParameterBlackboard *pParameterBlackboard, CSyn
         if (!_pLastAppliedConfiguration ||
             _pLastAppliedConfiguration != pApplicableDomainConfiguration) {
 
-            strInfo = "Applying configuration '" + pApplicableDomainConfiguration->getName() +
-                      "' from domain '" + getName() + "'";
+            if (pInfo != nullptr) {
+
+                *pInfo = "Applying configuration '" + pApplicableDomainConfiguration->getName() +
+                         "' from domain '" + getName() + "'";
+            }
 
-            // Check if we need to synchronize during restore
-            bool bSync = !pSyncerSet && _bSequenceAware;
+            if (pSyncerSet) {
 
-            // Do the restore
-            pApplicableDomainConfiguration->restore(pParameterBlackboard, bSync, nullptr);
+                // Restore differing areas and provide their syncers to caller
+                pApplicableDomainConfiguration->restoreDifferences(
+                    pParameterBlackboard, *pSyncerSet, _copiedAreaCount, _skippedAreaCount);
+            } else {
+
+                // Sequence aware, restore and synchronize all areas in order
+                pApplicableDomainConfiguration->restore(pParameterBlackboard, true, nullptr);
+            }
 
             // Record last applied configuration
             _pLastAppliedConfiguration = pApplicableDomainConfiguration;
+        }
+    }
+}
 
-            // Check we need to provide syncer set to caller
-            if (pSyncerSet && !_bSequenceAware) {
+// Criteria dependency
+void CConfigurableDomain::gatherCriteria(std::set<const CSelectionCriterion *> &criteria) const
+{
+    size_t uiNbConfigurations = getNbChildren();
 
-                // Since we applied changes, add our own sync set to the given one
-                *pSyncerSet += _syncerSet;
-            }
-        }
+    for (size_t uiChild = 0; uiChild < uiNbConfigurations; uiChild++) {
+
+        const CDomainConfiguration *pDomainConfiguration =
+            static_cast<const CDomainConfiguration *>(getChild(uiChild));
+
+        pDomainConfiguration->gatherCriteria(criteria);
+    }
+}
+
+void CConfigurableDomain::getRestoreStatistics(size_t &copiedAreas, size_t &skippedAreas) const
+{
+    copiedAreas += _copiedAreaCount;
+    skippedAreas += _skippedAreaCount;
+}
+
+// Settings deduplication
+void CConfigurableDomain::shareSettings(CBlackboardStore &store)
+{
+    size_t uiNbConfigurations = getNbChildren();
+
+    for (size_t uiChild = 0; uiChild < uiNbConfigurations; uiChild++) {
+
+        CDomainConfiguration *pDomainConfiguration =
+            static_cast<CDomainConfiguration *>(getChild(uiChild));
+
+        pDomainConfiguration->shareSettings(store);
+    }
+}
+
+void CConfigurableDomain::accountSettings(CBlackboardUsage &usage) const
+{
+    size_t uiNbConfigurations = getNbChildren();
+
+    for (size_t uiChild = 0; uiChild < uiNbConfigurations; uiChild++) {
+
+        const CDomainConfiguration *pDomainConfiguration =
+            static_cast<const CDomainConfiguration *>(getChild(uiChild));
+
+        pDomainConfiguration->accountSettings(usage);
+    }
+}
+
+// Subsystem dependency
+void CConfigurableDomain::gatherSubsystems(std::set<const CSubsystem *> &subsystems) const
+{
+    for (const CConfigurableElement *pConfigurableElement : _configurableElementList) {
+
+        subsystems.insert(pConfigurableElement->getBelongingSubsystem());
     }
 }
 
@@ -644,9 +845,13 @@ bool CConfigurableDomain::createConfiguration(const string &strName,
         pDomainConfiguration->addConfigurableElement(pConfigurableElement, pSyncerSet);
     }
 
+    pDomainConfiguration->packAreaConfigurations();
+
     // Hierarchy
     addChild(pDomainConfiguration);
 
+    invalidateDecisionTable();
+
     // Ensure validity of fresh new domain configuration
     // Attempt auto validation, so that the user gets his/her own settings by defaults
     if (!autoValidateConfiguration(pDomainConfiguration)) {
@@ -681,6 +886,8 @@ bool CConfigurableDomain::deleteConfiguration(const string &strName, string &str
     // Destroy
     delete pDomainConfiguration;
 
+    invalidateDecisionTable();
+
     return true;
 }
 
@@ -697,6 +904,14 @@ void CConfigurableDomain::listAssociatedToElements(string &strResult) const
     }
 }
 
+const CConfigurableElement *CConfigurableDomain::findConfigurableElement(
+    const string &strPath) const
+{
+    auto it = _configurableElementsByPath.find(strPath);
+
+    return it != _configurableElementsByPath.end() ? it->second : nullptr;
+}
+
 bool CConfigurableDomain::renameConfiguration(const string &strName, const string &strNewName,
                                               string &strError)
 {
@@ -803,6 +1018,8 @@ bool CConfigurableDomain::setApplicationRule(
         return false;
     }
 
+    invalidateDecisionTable();
+
     // Delegate to configuration
     return pDomainConfiguration->setApplicationRule(strApplicationRule,
                                                     pSelectionCriteriaDefinition, strError);
@@ -821,6 +1038,8 @@ bool CConfigurableDomain::clearApplicationRule(const string &strConfiguration, s
     // Delegate to configuration
     pDomainConfiguration->clearApplicationRule();
 
+    invalidateDecisionTable();
+
     return true;
 }
 
@@ -1015,6 +1234,57 @@ const CDomainConfiguration *CConfigurableDomain::findApplicableDomainConfigurati
     return nullptr;
 }
 
+const CDomainConfiguration *CConfigurableDomain::findMemorizedApplicableDomainConfiguration() const
+{
+    if (!_bDecisionTableValid) {
+
+        std::set<const CSelectionCriterion *> criteria;
+        gatherCriteria(criteria);
+
+        _decisionCriteria.assign(criteria.begin(), criteria.end());
+        _decisionTable.clear();
+        _bDecisionTableValid = true;
+    }
+
+    if (_decisionCriteria.size() > _decisionKeyMaxCriteria) {
+
+        return findApplicableDomainConfiguration();
+    }
+
+    // Decision key
+    DecisionKey states{};
+
+    for (size_t criterion = 0; criterion < _decisionCriteria.size(); criterion++) {
+
+        states[criterion] = _decisionCriteria[criterion]->getCriterionState();
+    }
+
+    auto it = _decisionTable.find(states);
+
+    if (it != _decisionTable.end()) {
+
+        return it->second;
+    }
+
+    const CDomainConfiguration *pDomainConfiguration = findApplicableDomainConfiguration();
+
+    // Keep the table bounded
+    if (_decisionTable.size() >= _decisionTableMaxSize) {
+
+        _decisionTable.clear();
+    }
+    _decisionTable.emplace(states, pDomainConfiguration);
+
+    return pDomainConfiguration;
+}
+
+void CConfigurableDomain::invalidateDecisionTable()
+{
+    _decisionCriteria.clear();
+    _decisionTable.clear();
+    _bDecisionTableValid = false;
+}
+
 // Gather set of configurable elements
 void CConfigurableDomain::gatherConfigurableElements(
     std::set<const CConfigurableElement *> &configurableElementSet) const
@@ -1143,6 +1413,13 @@ void CConfigurableDomain::doAddConfigurableElement(CConfigurableElement *pConfig
 
     // Add to list
     _configurableElementList.push_back(pConfigurableElement);
+    _configurableElementsByPath[pConfigurableElement->getPath()] = pConfigurableElement;
+
+    // Not needed on XML import (no main blackboard), packed once the element sequence is known
+    if (pMainBlackboard) {
+
+        packAreaConfigurations();
+    }
 }
 
 void CConfigurableDomain::doRemoveConfigurableElement(CConfigurableElement *pConfigurableElement,
@@ -1150,6 +1427,7 @@ void CConfigurableDomain::doRemoveConfigurableElement(CConfigurableElement *pCon
 {
     // Remove from list
     _configurableElementList.remove(pConfigurableElement);
+    _configurableElementsByPath.erase(pConfigurableElement->getPath());
 
     // Remove associated syncer set
     CSyncerSet *pSyncerSet = getSyncerSet(pConfigurableElement);
@@ -1171,10 +1449,24 @@ void CConfigurableDomain::doRemoveConfigurableElement(CConfigurableElement *pCon
 
         pDomainConfiguration->removeConfigurableElement(pConfigurableElement);
     }
-    // Recompute our sync set if needed
+    // Recompute our sync set and storage layout if needed
     if (bRecomputeSyncSet) {
 
         computeSyncSet();
+        packAreaConfigurations();
+    }
+}
+
+void CConfigurableDomain::packAreaConfigurations()
+{
+    size_t uiNbConfigurations = getNbChildren();
+
+    for (size_t uiChild = 0; uiChild < uiNbConfigurations; uiChild++) {
+
+        CDomainConfiguration *pDomainConfiguration =
+            static_cast<CDomainConfiguration *>(getChild(uiChild));
+
+        pDomainConfiguration->packAreaConfigurations();
     }
 }
 
@@ -34,15 +34,24 @@
 #include "XmlDomainExportContext.h"
 #include "SyncerSet.h"
 #include "Results.h"
+#include <array>
 #include <list>
 #include <set>
 #include <map>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 class CConfigurableElement;
+class CBlackboardStore;
+class CBlackboardUsage;
+class CBinaryStream;
 class CDomainConfiguration;
 class CParameterBlackboard;
 class CSelectionCriteriaDefinition;
+class CSelectionCriterion;
+class CSubsystem;
+class CSystemClass;
 
 class CConfigurableDomain : public CElement
 {
@@ -102,6 +111,13 @@ public:
         std::set<const CConfigurableElement *> &configurableElementSet) const;
     void listAssociatedToElements(std::string &strResult) const;
 
+    /** Find an associated configurable element from its path
+     *
+     * @param[in] strPath the path of the element
+     * @return the element, nullptr if not associated to the domain
+     */
+    const CConfigurableElement *findConfigurableElement(const std::string &strPath) const;
+
     /** Add a configurable element to the domain
      *
      * @param[in] pConfigurableElement pointer to the element to add
@@ -137,10 +153,36 @@ public:
      * @param[in] pParameterBlackboard the blackboard to synchronize
      * @param[in] pSyncerSet pointer to the set containing application syncers
      * @param[in] bForced boolean used to force configuration application
-     * @param[out] info string containing useful information we can provide to client
+     * @param[in] bDecisionTable boolean used to memorize applicable configurations per criterion
+     *                           states, see findMemorizedApplicableDomainConfiguration
+     * @param[out] pInfo string containing useful information we can provide to client,
+     *                   nullptr if not wanted
      */
     void apply(CParameterBlackboard *pParameterBlackboard, CSyncerSet *pSyncerSet, bool bForced,
-               std::string &info) const;
+               bool bDecisionTable, std::string *pInfo) const;
+
+    // Gather selection criteria the configurations' application rules depend on
+    void gatherCriteria(std::set<const CSelectionCriterion *> &criteria) const;
+
+    /** Gather subsystems the configurable elements belong to
+     *
+     * nullptr is gathered for elements not belonging to any subsystem (i.e. the system class).
+     *
+     * @param[out] subsystems set filled with the subsystems
+     */
+    void gatherSubsystems(std::set<const CSubsystem *> &subsystems) const;
+
+    /** Get the numbers of areas restored and skipped because already matching the main
+     * blackboard, while applying configurations
+     *
+     * @param[in,out] copiedAreas incremented by the number of restored areas
+     * @param[in,out] skippedAreas incremented by the number of skipped areas
+     */
+    void getRestoreStatistics(size_t &copiedAreas, size_t &skippedAreas) const;
+
+    // Settings deduplication, see CDomainConfiguration
+    void shareSettings(CBlackboardStore &store);
+    void accountSettings(CBlackboardUsage &usage) const;
 
     // Return applicable configuration validity for given configurable element
     bool isApplicableConfigurationValid(const CConfigurableElement *pConfigurableElement) const;
@@ -154,6 +196,16 @@ public:
     void childrenToXml(CXmlElement &xmlElement,
                        CXmlSerializingContext &serializingContext) const override;
 
+    /** Binary serializing of configurations, associated elements and settings
+     *
+     * Mirrors the XML import, faster to load as no parsing is needed. Associated elements are
+     * checked to still exist with the same footprint.
+     */
+    void binarySerialize(CBinaryStream &binaryStream) const;
+    bool binaryDeserialize(CBinaryStream &binaryStream, CSystemClass &systemClass,
+                           const CSelectionCriteriaDefinition *pSelectionCriteriaDefinition,
+                           std::string &strError);
+
     // Class kind
     std::string getKind() const override;
 
@@ -168,6 +220,21 @@ private:
     // Search for an applicable configuration
     const CDomainConfiguration *findApplicableDomainConfiguration() const;
 
+    /** Search for an applicable configuration through the decision table
+     *
+     * Looks the decision table up first, then evaluates the configurations' application rules
+     * and memorizes the result on a miss. Domains depending on too many criteria are always
+     * evaluated.
+     * The table is only accessed by apply, hence under the exclusive lock of the framework:
+     * other queries evaluate the rules.
+     *
+     * @return the applicable configuration, nullptr if none
+     */
+    const CDomainConfiguration *findMemorizedApplicableDomainConfiguration() const;
+
+    // Forget memorized decisions, to be called whenever a rule or configuration changes
+    void invalidateDecisionTable();
+
     // Returns true if children dynamic creation is to be dealt with (here, will allow child
     // deletion upon clean)
     bool childrenAreDynamic() const override;
@@ -224,6 +291,9 @@ private:
     void doRemoveConfigurableElement(CConfigurableElement *pConfigurableElement,
                                      bool bRecomputeSyncSet);
 
+    // Contiguous area storage of all configurations
+    void packAreaConfigurations();
+
     // XML parsing
     /**
      * Deserialize domain configurations from an Xml document and add them to
@@ -276,6 +346,9 @@ private:
     // Configurable elements
     std::list<CConfigurableElement *> _configurableElementList;
 
+    /** Configurable elements by path, shared by all configurations for settings lookup */
+    std::unordered_map<std::string, const CConfigurableElement *> _configurableElementsByPath;
+
     // Associated syncer sets
     std::map<const CConfigurableElement *, CSyncerSet *> _configurableElementToSyncerSetMap;
 
@@ -287,4 +360,26 @@ private:
 
     // Last applied configuration
     mutable const CDomainConfiguration *_pLastAppliedConfiguration{nullptr};
+
+    // Areas restored and skipped while applying configurations
+    mutable size_t _copiedAreaCount{0};
+    mutable size_t _skippedAreaCount{0};
+
+    // Maximum number of memorized decisions before the decision table is flushed
+    static const size_t _decisionTableMaxSize = 64;
+
+    // Maximum number of criteria the application rules may depend on to memorize decisions
+    static const size_t _decisionKeyMaxCriteria = 4;
+
+    // States of the decision criteria, unused trailing states are zero
+    using DecisionKey = std::array<int, _decisionKeyMaxCriteria>;
+
+    // Criteria the application rules depend on, in decision table key order
+    mutable std::vector<const CSelectionCriterion *> _decisionCriteria;
+
+    // Memorized applicable configuration, keyed by the states of the decision criteria
+    mutable std::map<DecisionKey, const CDomainConfiguration *> _decisionTable;
+
+    // Is the decision table consistent with the current rules
+    mutable bool _bDecisionTableValid{false};
 };
@@ -27,15 +27,26 @@
  * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
+#include <algorithm>
 #include <cassert>
 #include "ConfigurableDomains.h"
 #include "ConfigurableDomain.h"
 #include "ConfigurableElement.h"
+#include "SelectionCriterion.h"
+#include "BlackboardStore.h"
+#include "BinaryStream.h"
+#include "XmlStreamWriter.h"
+#include "SyncWorker.h"
+#include <sstream>
 
 #define base CElement
 
 using std::string;
 
+// Defined where CSyncWorker is complete, destruction stops apply workers
+CConfigurableDomains::CConfigurableDomains() = default;
+CConfigurableDomains::~CConfigurableDomains() = default;
+
 string CConfigurableDomains::getKind() const
 {
     return "ConfigurableDomains";
@@ -61,44 +72,261 @@ void CConfigurableDomains::validate(const CParameterBlackboard *pMainBlackboard)
     }
 }
 
+void CConfigurableDomains::clean()
+{
+    base::clean();
+
+    invalidateCriterionDependencies();
+    invalidatePartitions();
+}
+
 // Configuration application if required
 void CConfigurableDomains::apply(CParameterBlackboard *pParameterBlackboard, CSyncerSet &syncerSet,
-                                 bool bForce, core::Results &infos) const
+                                 bool bForce, bool bParallel, bool bDecisionTable,
+                                 core::Results *infos)
 {
-    /// Delegate to domains
+    // Domains or rules changed since last application, all domains need to be evaluated
+    bool bAllDomains = bForce || !_bCriterionDependenciesValid;
 
-    // Start with domains that can be synchronized all at once (with passed syncer set)
-    size_t uiNbConfigurableDomains = getNbChildren();
+    if (!_bCriterionDependenciesValid) {
 
-    for (size_t child = 0; child < uiNbConfigurableDomains; child++) {
+        computeCriterionDependencies();
+    }
 
-        const CConfigurableDomain *pChildConfigurableDomain =
-            static_cast<const CConfigurableDomain *>(getChild(child));
+    std::vector<const CConfigurableDomain *> domainsToApply = getDomainsToApply(bAllDomains);
+
+    if (bParallel && !_bPartitionsValid) {
+
+        computePartitions();
+    }
+    if (!bParallel || _partitions.size() < 2) {
+
+        applyDomains(pParameterBlackboard, syncerSet, domainsToApply, bForce, bDecisionTable,
+                     infos);
+        return;
+    }
+
+    // Dispatch domains to their partition
+    for (Partition &partition : _partitions) {
+
+        partition.domainsToApply.clear();
+    }
+    for (const CConfigurableDomain *pDomain : domainsToApply) {
+
+        _partitions[_domainToPartitionMap.find(pDomain)->second].domainsToApply.push_back(
+            pDomain);
+    }
+
+    // Synchronize syncers collected by the caller (subsystems to resync) before any partition
+    // starts: as in sequential mode, they are then synchronized before sequence aware domains.
+    // They may belong to subsystems of any partition, hence can not be synchronized along one.
+    syncerSet.sync(*pParameterBlackboard, false, nullptr, true);
+
+    auto applyPartition = [&](Partition &partition) {
+        partition.syncerSet.clear();
+        applyDomains(pParameterBlackboard, partition.syncerSet, partition.domainsToApply, bForce,
+                     bDecisionTable, infos != nullptr ? &partition.infos : nullptr);
+    };
+
+    // Apply each partition having domains to apply, first one in the calling thread
+    Partition *pCallerPartition = nullptr;
+    size_t nbBusyWorkers = 0;
+
+    for (Partition &partition : _partitions) {
+
+        if (partition.domainsToApply.empty()) {
+
+            continue;
+        }
+        if (pCallerPartition == nullptr) {
+
+            pCallerPartition = &partition;
+            continue;
+        }
+        _applyWorkers[nbBusyWorkers++]->post(
+            [&applyPartition, &partition] { applyPartition(partition); });
+    }
+    if (pCallerPartition != nullptr) {
+
+        applyPartition(*pCallerPartition);
+    }
+    for (size_t worker = 0; worker < nbBusyWorkers; worker++) {
+
+        _applyWorkers[worker]->wait();
+    }
+
+    if (infos != nullptr) {
+
+        for (Partition &partition : _partitions) {
+
+            infos->splice(infos->end(), partition.infos);
+        }
+    }
+}
+
+void CConfigurableDomains::applyDomains(CParameterBlackboard *pParameterBlackboard,
+                                        CSyncerSet &syncerSet,
+                                        const std::vector<const CConfigurableDomain *> &domains,
+                                        bool bForce, bool bDecisionTable,
+                                        core::Results *infos)
+{
+    /// Delegate to domains
+
+    // Start with domains that can be synchronized all at once (with passed syncer set)
+    for (const CConfigurableDomain *pChildConfigurableDomain : domains) {
 
         std::string info;
         // Apply and collect syncers when relevant
-        pChildConfigurableDomain->apply(pParameterBlackboard, &syncerSet, bForce, info);
+        pChildConfigurableDomain->apply(pParameterBlackboard, &syncerSet, bForce, bDecisionTable,
+                                        infos != nullptr ? &info : nullptr);
 
         if (!info.empty()) {
-            infos.push_back(info);
+            infos->push_back(info);
         }
     }
-    // Synchronize those collected syncers
-    syncerSet.sync(*pParameterBlackboard, false, nullptr);
+    // Synchronize those collected syncers, skipping unchanged areas
+    syncerSet.sync(*pParameterBlackboard, false, nullptr, true);
 
     // Then deal with domains that need to synchronize along apply
+    for (const CConfigurableDomain *pChildConfigurableDomain : domains) {
+
+        std::string info;
+        // Apply and synchronize when relevant
+        pChildConfigurableDomain->apply(pParameterBlackboard, nullptr, bForce, bDecisionTable,
+                                        infos != nullptr ? &info : nullptr);
+        if (!info.empty()) {
+            infos->push_back(info);
+        }
+    }
+}
+
+void CConfigurableDomains::computePartitions()
+{
+    _partitions.clear();
+    _domainToPartitionMap.clear();
+    _bPartitionsValid = true;
+
+    size_t uiNbConfigurableDomains = getNbChildren();
+
+    // Union-find over domain indexes, a partition is identified by its lowest domain index
+    std::vector<size_t> parents(uiNbConfigurableDomains);
+    std::map<const CSubsystem *, size_t> subsystemToDomainIndexMap;
+
+    auto findRoot = [&parents](size_t index) {
+        while (parents[index] != index) {
+            index = parents[index] = parents[parents[index]];
+        }
+        return index;
+    };
+
+    for (size_t child = 0; child < uiNbConfigurableDomains; child++) {
+
+        parents[child] = child;
+
+        std::set<const CSubsystem *> subsystems;
+        static_cast<const CConfigurableDomain *>(getChild(child))->gatherSubsystems(subsystems);
+
+        if (subsystems.count(nullptr) != 0) {
+
+            // Element spanning several subsystems, domains can not be partitioned
+            return;
+        }
+        for (const CSubsystem *pSubsystem : subsystems) {
+
+            auto it = subsystemToDomainIndexMap.emplace(pSubsystem, child).first;
+
+            // Merge with the partition of the domains sharing this subsystem
+            size_t root = findRoot(it->second);
+            size_t ownRoot = findRoot(child);
+
+            parents[std::max(root, ownRoot)] = std::min(root, ownRoot);
+        }
+    }
+
+    std::map<size_t, size_t> rootToPartitionMap;
+
+    for (size_t child = 0; child < uiNbConfigurableDomains; child++) {
+
+        auto it = rootToPartitionMap.emplace(findRoot(child), rootToPartitionMap.size()).first;
+
+        _domainToPartitionMap[static_cast<const CConfigurableDomain *>(getChild(child))] =
+            it->second;
+    }
+    _partitions.resize(rootToPartitionMap.size());
+
+    // The caller applies one partition
+    while (_applyWorkers.size() + 1 < _partitions.size()) {
+
+        _applyWorkers.emplace_back(new CSyncWorker);
+    }
+}
+
+void CConfigurableDomains::invalidatePartitions()
+{
+    _bPartitionsValid = false;
+}
+
+// Criterion to domain dependencies
+void CConfigurableDomains::computeCriterionDependencies()
+{
+    _criterionToDomainIndexesMap.clear();
+
+    size_t uiNbConfigurableDomains = getNbChildren();
+
     for (size_t child = 0; child < uiNbConfigurableDomains; child++) {
 
         const CConfigurableDomain *pChildConfigurableDomain =
             static_cast<const CConfigurableDomain *>(getChild(child));
 
-        std::string info;
-        // Apply and synchronize when relevant
-        pChildConfigurableDomain->apply(pParameterBlackboard, nullptr, bForce, info);
-        if (!info.empty()) {
-            infos.push_back(info);
+        std::set<const CSelectionCriterion *> criteria;
+
+        pChildConfigurableDomain->gatherCriteria(criteria);
+
+        for (const CSelectionCriterion *pSelectionCriterion : criteria) {
+
+            _criterionToDomainIndexesMap[pSelectionCriterion].push_back(child);
         }
     }
+    _bCriterionDependenciesValid = true;
+}
+
+void CConfigurableDomains::invalidateCriterionDependencies()
+{
+    _bCriterionDependenciesValid = false;
+}
+
+std::vector<const CConfigurableDomain *> CConfigurableDomains::getDomainsToApply(
+    bool bAllDomains) const
+{
+    size_t uiNbConfigurableDomains = getNbChildren();
+    std::vector<bool> domainIsSelected(uiNbConfigurableDomains, bAllDomains);
+
+    if (!bAllDomains) {
+
+        // Only domains depending on a criterion modified since last application
+        for (const auto &criterionToDomainIndexes : _criterionToDomainIndexesMap) {
+
+            if (!criterionToDomainIndexes.first->hasBeenModified()) {
+
+                continue;
+            }
+            for (size_t child : criterionToDomainIndexes.second) {
+
+                domainIsSelected[child] = true;
+            }
+        }
+    }
+
+    std::vector<const CConfigurableDomain *> domains;
+
+    for (size_t child = 0; child < uiNbConfigurableDomains; child++) {
+
+        if (domainIsSelected[child]) {
+
+            domains.push_back(static_cast<const CConfigurableDomain *>(getChild(child)));
+        }
+    }
+    return domains;
 }
 
 // From IXmlSource
@@ -111,6 +339,67 @@ void CConfigurableDomains::toXml(CXmlElement &xmlElement,
     base::childrenToXml(xmlElement, serializingContext);
 }
 
+bool CConfigurableDomains::toXml(CXmlStreamWriter &writer,
+                                 CXmlSerializingContext &serializingContext) const
+{
+    if (!writer.startDocument(getXmlElementName(), serializingContext) ||
+        !writer.setRootAttribute("SystemClassName", getName(), serializingContext)) {
+
+        return false;
+    }
+    for (size_t child = 0; child < getNbChildren(); child++) {
+
+        const CElement *pChild = getChild(child);
+
+        if (!writer.writeChild(*pChild, pChild->getXmlElementName(), serializingContext)) {
+
+            return false;
+        }
+    }
+    return writer.endDocument(serializingContext);
+}
+
+// Binary serializing
+void CConfigurableDomains::binarySerialize(CBinaryStream &binaryStream) const
+{
+    size_t uiNbConfigurableDomains = getNbChildren();
+    binaryStream.writeInteger(static_cast<uint32_t>(uiNbConfigurableDomains));
+
+    for (size_t child = 0; child < uiNbConfigurableDomains; child++) {
+
+        static_cast<const CConfigurableDomain *>(getChild(child))->binarySerialize(binaryStream);
+    }
+}
+
+bool CConfigurableDomains::binaryDeserialize(
+    CBinaryStream &binaryStream, CSystemClass &systemClass,
+    const CSelectionCriteriaDefinition *pSelectionCriteriaDefinition, string &strError)
+{
+    // Start clean
+    clean();
+
+    uint32_t nbConfigurableDomains;
+
+    if (!binaryStream.readInteger(nbConfigurableDomains)) {
+
+        strError = "Truncated configurable domains";
+        return false;
+    }
+    for (uint32_t domain = 0; domain < nbConfigurableDomains; ++domain) {
+
+        auto pConfigurableDomain = new CConfigurableDomain;
+        addChild(pConfigurableDomain);
+
+        if (!pConfigurableDomain->binaryDeserialize(binaryStream, systemClass,
+                                                    pSelectionCriteriaDefinition, strError)) {
+
+            clean();
+            return false;
+        }
+    }
+    return true;
+}
+
 // Configuration/Domains handling
 /// Domains
 bool CConfigurableDomains::createDomain(const string &strName, string &strError)
@@ -126,6 +415,9 @@ bool CConfigurableDomains::createDomain(const string &strName, string &strError)
     // Creation/Hierarchy
     addChild(new CConfigurableDomain(strName));
 
+    invalidateCriterionDependencies();
+    invalidatePartitions();
+
     return true;
 }
 
@@ -148,6 +440,9 @@ bool CConfigurableDomains::addDomain(CConfigurableDomain &domain, bool bOverwrit
 
     addChild(&domain);
 
+    invalidateCriterionDependencies();
+    invalidatePartitions();
+
     return true;
 }
 
@@ -156,6 +451,9 @@ void CConfigurableDomains::deleteDomain(CConfigurableDomain &configurableDomain)
     removeChild(&configurableDomain);
 
     delete &configurableDomain;
+
+    invalidateCriterionDependencies();
+    invalidatePartitions();
 }
 
 bool CConfigurableDomains::deleteDomain(const string &strName, string &strError)
@@ -247,6 +545,8 @@ bool CConfigurableDomains::createConfiguration(const string &strDomain,
 
         return false;
     }
+    invalidateCriterionDependencies();
+
     // Delegate
     return pConfigurableDomain->createConfiguration(strConfiguration, pMainBlackboard, strError);
 }
@@ -261,6 +561,8 @@ bool CConfigurableDomains::deleteConfiguration(const string &strDomain,
 
         return false;
     }
+    invalidateCriterionDependencies();
+
     // Delegate
     return pConfigurableDomain->deleteConfiguration(strConfiguration, strError);
 }
@@ -311,6 +613,7 @@ bool CConfigurableDomains::split(const string &domainName, CConfigurableElement
     }
     // Delegate
     domain->split(element, infos);
+    invalidatePartitions();
 
     return true;
 }
@@ -481,6 +784,8 @@ bool CConfigurableDomains::setApplicationRule(
         return false;
     }
 
+    invalidateCriterionDependencies();
+
     // Delegate to domain
     return pConfigurableDomain->setApplicationRule(strConfiguration, strApplicationRule,
                                                    pSelectionCriteriaDefinition, strError);
@@ -496,6 +801,8 @@ bool CConfigurableDomains::clearApplicationRule(const string &strDomain,
         return false;
     }
 
+    invalidateCriterionDependencies();
+
     // Delegate to domain
     return pConfigurableDomain->clearApplicationRule(strConfiguration, strError);
 }
@@ -532,6 +839,69 @@ void CConfigurableDomains::listLastAppliedConfigurations(string &strResult) cons
     }
 }
 
+// Restore statistics
+void CConfigurableDomains::listRestoreStatistics(string &strResult) const
+{
+    size_t copiedAreas = 0;
+    size_t skippedAreas = 0;
+
+    // Browse domains
+    size_t uiNbConfigurableDomains = getNbChildren();
+
+    for (size_t child = 0; child < uiNbConfigurableDomains; child++) {
+
+        const CConfigurableDomain *pChildConfigurableDomain =
+            static_cast<const CConfigurableDomain *>(getChild(child));
+
+        pChildConfigurableDomain->getRestoreStatistics(copiedAreas, skippedAreas);
+    }
+    strResult += "Copied: " + std::to_string(copiedAreas) + "\n";
+    strResult += "Skipped: " + std::to_string(skippedAreas) + "\n";
+}
+
+// Settings deduplication
+void CConfigurableDomains::shareSettings()
+{
+    CBlackboardStore store;
+
+    // Browse domains
+    size_t uiNbConfigurableDomains = getNbChildren();
+
+    for (size_t child = 0; child < uiNbConfigurableDomains; child++) {
+
+        CConfigurableDomain *pChildConfigurableDomain =
+            static_cast<CConfigurableDomain *>(getChild(child));
+
+        pChildConfigurableDomain->shareSettings(store);
+    }
+}
+
+void CConfigurableDomains::listSettingsUsage(string &strResult) const
+{
+    CBlackboardUsage usage;
+
+    // Browse domains
+    size_t uiNbConfigurableDomains = getNbChildren();
+
+    for (size_t child = 0; child < uiNbConfigurableDomains; child++) {
+
+        const CConfigurableDomain *pChildConfigurableDomain =
+            static_cast<const CConfigurableDomain *>(getChild(child));
+
+        pChildConfigurableDomain->accountSettings(usage);
+    }
+    std::ostringstream ratio;
+    ratio.precision(2);
+    ratio << std::fixed
+          << (usage.getStorageSize() != 0
+                  ? double(usage.getContentSize()) / double(usage.getStorageSize())
+                  : 1.0);
+
+    strResult += "Settings: " + std::to_string(usage.getContentSize()) + " bytes\n";
+    strResult += "Stored: " + std::to_string(usage.getStorageSize()) + " bytes\n";
+    strResult += "Ratio: " + ratio.str() + "\n";
+}
+
 // Configurable element - domain association
 bool CConfigurableDomains::addConfigurableElementToDomain(
     const string &domainName, CConfigurableElement *element,
@@ -546,6 +916,8 @@ bool CConfigurableDomains::addConfigurableElementToDomain(
         infos.push_back(error);
         return false;
     }
+    invalidatePartitions();
+
     // Delegate
     return domain->addConfigurableElement(element, mainBlackboard, infos);
 }
@@ -560,6 +932,8 @@ bool CConfigurableDomains::removeConfigurableElementFromDomain(
 
         return false;
     }
+    invalidatePartitions();
+
     // Delegate
     return pConfigurableDomain->removeConfigurableElement(pConfigurableElement, strError);
 }
@@ -31,18 +31,30 @@
 
 #include "Element.h"
 #include "Results.h"
+#include "SyncerSet.h"
+#include <map>
+#include <memory>
 #include <set>
 #include <string>
+#include <vector>
 
 class CParameterBlackboard;
 class CConfigurableElement;
 class CSyncerSet;
 class CConfigurableDomain;
 class CSelectionCriteriaDefinition;
+class CSelectionCriterion;
+class CBinaryStream;
+class CSystemClass;
+class CXmlStreamWriter;
+class CSyncWorker;
 
 class CConfigurableDomains : public CElement
 {
 public:
+    CConfigurableDomains();
+    ~CConfigurableDomains() override;
+
     // Configuration/Domains handling
     /// Domains
     bool createDomain(const std::string &strName, std::string &strError);
@@ -134,6 +146,18 @@ public:
     // Last applied configurations
     void listLastAppliedConfigurations(std::string &strResult) const;
 
+    // Areas restored and skipped because already up to date while applying configurations
+    void listRestoreStatistics(std::string &strResult) const;
+
+    /** Share storage of identical configuration settings across all domains
+     *
+     * Shared settings are copied back on modification.
+     */
+    void shareSettings();
+
+    // Memory used by configuration settings, with and without deduplication
+    void listSettingsUsage(std::string &strResult) const;
+
     /** Associate a configurable element to a domain
      *
      * @param[in] domainName the domain name
@@ -163,22 +187,57 @@ public:
     // From IXmlSource
     void toXml(CXmlElement &xmlElement, CXmlSerializingContext &serializingContext) const override;
 
+    /** Same as toXml, written to a stream one domain at a time
+     *
+     * Only one domain is held in memory as a XML tree, whatever the number of domains.
+     *
+     * @param[in] writer the stream writer, no document started yet
+     * @param[in,out] serializingContext the serializing context, used as error output
+     * @return false if any error occurs
+     */
+    bool toXml(CXmlStreamWriter &writer, CXmlSerializingContext &serializingContext) const;
+
+    /** Binary serializing of all domains, see CConfigurableDomain
+     *
+     * Existing domains are replaced on deserialization.
+     */
+    void binarySerialize(CBinaryStream &binaryStream) const;
+    bool binaryDeserialize(CBinaryStream &binaryStream, CSystemClass &systemClass,
+                           const CSelectionCriteriaDefinition *pSelectionCriteriaDefinition,
+                           std::string &strError);
+
     // Ensure validity on whole domains from main blackboard
     void validate(const CParameterBlackboard *pMainBlackboard);
 
     /** Apply the configuration if required
+     *
+     * Unless forced, only domains whose application rules depend on a modified selection
+     * criterion are evaluated. The criterion to domain dependencies are (re)computed on forced
+     * application and whenever domains or rules have been changed since last computation.
+     *
+     * In parallel mode, domains are partitioned so that no two partitions share a subsystem and
+     * each partition is applied and synchronized by its own worker thread. Within a partition,
+     * domains are applied in the same order as in sequential mode, so that sequence-aware
+     * domains keep their ordering guarantees. Partitions are computed once, then whenever
+     * domains or their elements have been changed. Worker threads are kept across applications.
      *
      * @param[in] pParameterBlackboard the blackboard to synchronize
      * @param[in] syncerSet the set containing application syncers
      * @param[in] bForce boolean used to force configuration application
-     * @param[out] infos useful information we can provide to client
+     * @param[in] bParallel boolean used to apply independent domains concurrently
+     * @param[in] bDecisionTable boolean used to memorize applicable configurations per
+     *                           criterion states
+     * @param[out] infos useful information we can provide to client, nullptr if not wanted
      */
     void apply(CParameterBlackboard *pParameterBlackboard, CSyncerSet &syncerSet, bool bForce,
-               core::Results &infos) const;
+               bool bParallel, bool bDecisionTable, core::Results *infos);
 
     // Class kind
     std::string getKind() const override;
 
+    // From CElement
+    void clean() override;
+
 private:
     /** Delete a domain
      *
@@ -196,4 +255,51 @@ private:
     // Domain retrieval
     CConfigurableDomain *findConfigurableDomain(const std::string &strDomain,
                                                 std::string &strError);
+
+    // Criterion to domain dependencies
+    void computeCriterionDependencies();
+    void invalidateCriterionDependencies();
+    // Domains to be evaluated by apply, in children order
+    std::vector<const CConfigurableDomain *> getDomainsToApply(bool bAllDomains) const;
+
+    /** Apply domains and synchronize them
+     *
+     * Domains that are not sequence aware are all restored, then synchronized at once along
+     * with the syncers already in syncerSet. Sequence aware domains are then restored and
+     * synchronized one after the other.
+     */
+    static void applyDomains(CParameterBlackboard *pParameterBlackboard, CSyncerSet &syncerSet,
+                             const std::vector<const CConfigurableDomain *> &domains, bool bForce,
+                             bool bDecisionTable, core::Results *infos);
+
+    /** Partition domains so that no two partitions share a subsystem
+     *
+     * No partition at all is computed if a domain has elements outside any subsystem.
+     */
+    void computePartitions();
+    void invalidatePartitions();
+
+    /** Indexes of the domains depending on each selection criterion */
+    std::map<const CSelectionCriterion *, std::vector<size_t>> _criterionToDomainIndexesMap;
+
+    /** Whether above map reflects the current domains and rules */
+    bool _bCriterionDependenciesValid{false};
+
+    /** Domains applied by a worker thread, along with their own syncer set */
+    struct Partition
+    {
+        /** Domains to apply, in children order, only relevant while applying */
+        std::vector<const CConfigurableDomain *> domainsToApply;
+        CSyncerSet syncerSet;
+        core::Results infos;
+    };
+    /** Domains partitioned by subsystem, for parallel application */
+    std::vector<Partition> _partitions;
+    /** Index in above partitions of each domain */
+    std::map<const CConfigurableDomain *, size_t> _domainToPartitionMap;
+    /** Whether above partitions reflect the current domains and their elements */
+    bool _bPartitionsValid{false};
+
+    /** Threads applying all partitions but the one applied by the caller */
+    std::vector<std::unique_ptr<CSyncWorker>> _applyWorkers;
 };
@@ -340,10 +340,16 @@ void CConfigurableElement::setOffset(size_t offset)
         CConfigurableElement *pConfigurableElement =
             static_cast<CConfigurableElement *>(getChild(index));
 
+        pConfigurableElement->_depth = _depth + 1;
         pConfigurableElement->setOffset(offset);
 
+        // Frozen by now
         offset += pConfigurableElement->getFootPrint();
     }
+
+    // Structure is complete, freeze it
+    _footPrint = getFootPrint();
+    _bFrozen = true;
 }
 
 size_t CConfigurableElement::getOffset() const
@@ -354,6 +360,11 @@ size_t CConfigurableElement::getOffset() const
 // Memory
 size_t CConfigurableElement::getFootPrint() const
 {
+    if (_bFrozen) {
+
+        return _footPrint;
+    }
+
     size_t uiSize = 0;
     size_t uiNbChildren = getNbChildren();
 
@@ -368,6 +379,30 @@ size_t CConfigurableElement::getFootPrint() const
     return uiSize;
 }
 
+bool CConfigurableElement::isDescendantOf(const CConfigurableElement *pCandidateAscendant) const
+{
+    if (!_bFrozen || !pCandidateAscendant->_bFrozen) {
+
+        return base::isDescendantOf(pCandidateAscendant);
+    }
+
+    // Descendants are deeper and lie within the blackboard area of their ascendants
+    if (_depth <= pCandidateAscendant->_depth || _offset < pCandidateAscendant->_offset ||
+        _offset + _footPrint > pCandidateAscendant->_offset + pCandidateAscendant->_footPrint) {
+
+        return false;
+    }
+
+    // Areas may be empty or shared with siblings, check the actual ascendant at that depth
+    const CElement *pAscendant = this;
+
+    for (size_t depth = _depth; depth > pCandidateAscendant->_depth; depth--) {
+
+        pAscendant = pAscendant->getParent();
+    }
+    return pAscendant == pCandidateAscendant;
+}
+
 // Browse parent path to find syncer
 ISyncer *CConfigurableElement::getSyncer() const
 {
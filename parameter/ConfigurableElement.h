@@ -55,13 +55,28 @@ public:
     CConfigurableElement(const std::string &strName = "");
     ~CConfigurableElement() override = default;
 
-    // Offset in main blackboard
+    /** Set the offset in the main blackboard, of this element and its descendants
+     *
+     * Once the structure is loaded, also freezes their footprint and depth in the tree, for
+     * constant time footprint and faster ancestry queries.
+     *
+     * @param[in] offset the offset of this element
+     */
     void setOffset(size_t offset);
     size_t getOffset() const;
 
     // Allocation
     virtual size_t getFootPrint() const;
 
+    using CElement::isDescendantOf;
+
+    /** Ancestry check, mostly by blackboard area containment once offsets are set
+     *
+     * @param[in] pCandidateAscendant the candidate ascendant element
+     * @return true if this element is a descendant of the candidate, false otherwise
+     */
+    bool isDescendantOf(const CConfigurableElement *pCandidateAscendant) const;
+
     // Syncer set (me, ascendant or descendant ones)
     void fillSyncerSet(CSyncerSet &syncerSet) const;
 
@@ -229,6 +244,11 @@ private:
     // Offset in main blackboard
     size_t _offset{0};
 
+    /** Footprint and depth from the system class, valid once frozen by setOffset */
+    size_t _footPrint{0};
+    size_t _depth{0};
+    bool _bFrozen{false};
+
     // Associated configurable domains
     std::list<const CConfigurableDomain *> _configurableDomainList;
 };
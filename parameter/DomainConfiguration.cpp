@@ -29,6 +29,7 @@
  */
 #include "DomainConfiguration.h"
 #include "ConfigurableElement.h"
+#include "ConfigurableDomain.h"
 #include "CompoundRule.h"
 #include "Subsystem.h"
 #include "XmlDomainSerializingContext.h"
@@ -36,6 +37,8 @@
 #include "XmlDomainExportContext.h"
 #include "ConfigurationAccessContext.h"
 #include "AlwaysAssert.hpp"
+#include "BlackboardStore.h"
+#include "BinaryStream.h"
 #include <assert.h>
 #include <cstdlib>
 #include <algorithm>
@@ -215,14 +218,21 @@ void CDomainConfiguration::addConfigurableElement(const CConfigurableElement *co
                                                   const CSyncerSet *syncerSet)
 {
     mAreaConfigurationList.emplace_back(configurableElement->createAreaConfiguration(syncerSet));
+
+    _areaConfigurationIndex[configurableElement] = std::prev(end(mAreaConfigurationList));
 }
 
 void CDomainConfiguration::removeConfigurableElement(
     const CConfigurableElement *pConfigurableElement)
 {
-    auto &areaConfigurationToRemove = getAreaConfiguration(pConfigurableElement);
+    auto it = _areaConfigurationIndex.find(pConfigurableElement);
+
+    ALWAYS_ASSERT(it != _areaConfigurationIndex.end(),
+                  "Configurable Element " << pConfigurableElement->getName()
+                                          << " not found in Domain Configuration list");
 
-    mAreaConfigurationList.remove(areaConfigurationToRemove);
+    mAreaConfigurationList.erase(it->second);
+    _areaConfigurationIndex.erase(it);
 }
 
 bool CDomainConfiguration::setElementSequence(const std::vector<string> &newElementSequence,
@@ -254,6 +264,123 @@ bool CDomainConfiguration::setElementSequence(const std::vector<string> &newElem
         // areaConfiguration is still valid, but now refer to the reorderer list
         insertLocation = std::next(areaConfiguration);
     }
+    packAreaConfigurations();
+
+    return true;
+}
+
+void CDomainConfiguration::packAreaConfigurations()
+{
+    size_t size = 0;
+
+    for (const auto &areaConfiguration : mAreaConfigurationList) {
+
+        const CParameterBlackboard &blackboard = areaConfiguration->getBlackboard();
+
+        if (blackboard.getSharedStorage() == nullptr) {
+
+            size += blackboard.getSize();
+        }
+    }
+
+    // Fresh storage, the current one holding the data to be moved
+    std::vector<uint8_t> storage(size);
+    size_t offset = 0;
+
+    for (auto &areaConfiguration : mAreaConfigurationList) {
+
+        CParameterBlackboard &blackboard = areaConfiguration->getBlackboard();
+
+        if (blackboard.getSharedStorage() == nullptr) {
+
+            blackboard.setStorage(storage.data() + offset);
+            offset += blackboard.getSize();
+        }
+    }
+    _areaStorage.swap(storage);
+}
+
+void CDomainConfiguration::shareSettings(CBlackboardStore &store)
+{
+    for (auto &areaConfiguration : mAreaConfigurationList) {
+
+        store.share(areaConfiguration->getBlackboard());
+    }
+    // Pack remaining unshared areas
+    packAreaConfigurations();
+}
+
+void CDomainConfiguration::accountSettings(CBlackboardUsage &usage) const
+{
+    for (const auto &areaConfiguration : mAreaConfigurationList) {
+
+        usage.account(areaConfiguration->getBlackboard());
+    }
+}
+
+// Binary serializing
+void CDomainConfiguration::binarySerialize(CBinaryStream &binaryStream) const
+{
+    const CCompoundRule *pRule = getRule();
+    binaryStream.writeString(pRule ? pRule->dump() : "");
+
+    // Areas, in element sequence order
+    binaryStream.writeInteger(static_cast<uint32_t>(mAreaConfigurationList.size()));
+
+    for (const auto &areaConfiguration : mAreaConfigurationList) {
+
+        binaryStream.writeString(areaConfiguration->getConfigurableElement()->getPath());
+        areaConfiguration->binarySerialize(binaryStream);
+    }
+}
+
+bool CDomainConfiguration::binaryDeserialize(
+    CBinaryStream &binaryStream, const CSelectionCriteriaDefinition *pSelectionCriteriaDefinition,
+    string &strError)
+{
+    string strRule;
+    uint32_t nbAreas;
+
+    if (!binaryStream.readString(strRule) || !binaryStream.readInteger(nbAreas)) {
+
+        strError = "Truncated configuration " + getPath();
+        return false;
+    }
+    if (!strRule.empty() &&
+        !setApplicationRule(strRule, pSelectionCriteriaDefinition, strError)) {
+
+        strError = "Invalid rule of configuration " + getPath() + ": " + strError;
+        return false;
+    }
+    if (nbAreas != mAreaConfigurationList.size()) {
+
+        strError = "Unexpected number of elements in configuration " + getPath();
+        return false;
+    }
+    auto insertLocation = begin(mAreaConfigurationList);
+
+    for (uint32_t area = 0; area < nbAreas; ++area) {
+
+        string configurableElementPath;
+
+        if (!binaryStream.readString(configurableElementPath)) {
+
+            strError = "Truncated configuration " + getPath();
+            return false;
+        }
+        auto areaConfiguration = findAreaConfigurationByPath(configurableElementPath);
+
+        if (areaConfiguration == end(mAreaConfigurationList) ||
+            !(*areaConfiguration)->binaryDeserialize(binaryStream)) {
+
+            strError = "Invalid settings of element " + configurableElementPath +
+                       " in configuration " + getPath();
+            return false;
+        }
+        // Restore element sequence, as done when parsing XML settings
+        mAreaConfigurationList.splice(insertLocation, mAreaConfigurationList, areaConfiguration);
+        insertLocation = std::next(areaConfiguration);
+    }
     return true;
 }
 
@@ -297,6 +424,19 @@ string CDomainConfiguration::getApplicationRule() const
     return pRule ? pRule->dump() : "<none>";
 }
 
+void CDomainConfiguration::compileApplicationRule()
+{
+    const CCompoundRule *pRule = getRule();
+
+    if (pRule) {
+
+        _ruleProgram.compile(*pRule);
+    } else {
+
+        _ruleProgram.clear();
+    }
+}
+
 /**
  * Get the Configuration Blackboard.
  *
@@ -312,15 +452,12 @@ string CDomainConfiguration::getApplicationRule() const
 CParameterBlackboard *CDomainConfiguration::getBlackboard(
     const CConfigurableElement *pConfigurableElement) const
 {
-    const auto &it = find_if(begin(mAreaConfigurationList), end(mAreaConfigurationList),
-                             [&](const AreaConfiguration &conf) {
-                                 return conf != nullptr &&
-                                        conf->getConfigurableElement() == pConfigurableElement;
-                             });
-    ALWAYS_ASSERT(it != end(mAreaConfigurationList), "Configurable Element "
-                                                         << pConfigurableElement->getName()
-                                                         << " not found in any area Configuration");
-    return &(*it)->getBlackboard();
+    auto it = _areaConfigurationIndex.find(pConfigurableElement);
+
+    ALWAYS_ASSERT(it != _areaConfigurationIndex.end(),
+                  "Configurable Element " << pConfigurableElement->getName()
+                                          << " not found in any area Configuration");
+    return &(*it->second)->getBlackboard();
 }
 
 // Save data from current
@@ -336,12 +473,68 @@ void CDomainConfiguration::save(const CParameterBlackboard *pMainBlackboard)
 bool CDomainConfiguration::restore(CParameterBlackboard *pMainBlackboard, bool bSync,
                                    core::Results *errors) const
 {
+    // Areas contiguous both in storage and in the main blackboard are copied at once
+    const uint8_t *runStorage = nullptr;
+    size_t runOffset = 0;
+    size_t runSize = 0;
+
+    auto restoreRun = [&] {
+        if (runSize != 0) {
+
+            pMainBlackboard->writeBuffer(runStorage, runSize, runOffset);
+            runSize = 0;
+        }
+    };
+
+    for (const auto &areaConfiguration : mAreaConfigurationList) {
+
+        if (!areaConfiguration->isRestoredAsIs()) {
+
+            restoreRun();
+            areaConfiguration->restore(pMainBlackboard, false, nullptr);
+            continue;
+        }
+        assert(areaConfiguration->isValid());
+
+        const CParameterBlackboard &blackboard = areaConfiguration->getBlackboard();
+        size_t offset = areaConfiguration->getConfigurableElement()->getOffset();
+
+        if (blackboard.getStorage() != runStorage + runSize || offset != runOffset + runSize) {
+
+            restoreRun();
+            runStorage = blackboard.getStorage();
+            runOffset = offset;
+        }
+        runSize += blackboard.getSize();
+    }
+    restoreRun();
+
+    if (!bSync) {
+
+        return true;
+    }
     return std::accumulate(begin(mAreaConfigurationList), end(mAreaConfigurationList), true,
                            [&](bool accumulator, const AreaConfiguration &conf) {
-                               return conf->restore(pMainBlackboard, bSync, errors) && accumulator;
+                               return conf->sync(pMainBlackboard, errors) && accumulator;
                            });
 }
 
+void CDomainConfiguration::restoreDifferences(CParameterBlackboard *pMainBlackboard,
+                                              CSyncerSet &syncerSet, size_t &copiedAreas,
+                                              size_t &skippedAreas) const
+{
+    for (const auto &areaConfiguration : mAreaConfigurationList) {
+
+        if (areaConfiguration->restoreDifferences(pMainBlackboard, syncerSet)) {
+
+            copiedAreas++;
+        } else {
+
+            skippedAreas++;
+        }
+    }
+}
+
 // Ensure validity for configurable element area configuration
 void CDomainConfiguration::validate(const CConfigurableElement *pConfigurableElement,
                                     const CParameterBlackboard *pMainBlackboard)
@@ -409,7 +602,23 @@ bool CDomainConfiguration::isApplicable() const
 {
     const CCompoundRule *pRule = getRule();
 
-    return pRule && pRule->matches();
+    if (!pRule) {
+
+        return false;
+    }
+    // Falls back to rule tree evaluation if not compiled yet
+    return _ruleProgram.matches(*pRule);
+}
+
+// Criteria dependency
+void CDomainConfiguration::gatherCriteria(std::set<const CSelectionCriterion *> &criteria) const
+{
+    const CCompoundRule *pRule = getRule();
+
+    if (pRule) {
+
+        pRule->gatherCriteria(criteria);
+    }
 }
 
 // Merge existing configurations to given configurable element ones
@@ -450,25 +659,25 @@ void CDomainConfiguration::split(CConfigurableElement *pFromConfigurableElement)
 const CDomainConfiguration::AreaConfiguration &CDomainConfiguration::getAreaConfiguration(
     const CConfigurableElement *pConfigurableElement) const
 {
-    const auto &it = find_if(begin(mAreaConfigurationList), end(mAreaConfigurationList),
-                             [&](const AreaConfiguration &conf) {
-                                 return conf->getConfigurableElement() == pConfigurableElement;
-                             });
-    ALWAYS_ASSERT(it != end(mAreaConfigurationList),
+    auto it = _areaConfigurationIndex.find(pConfigurableElement);
+
+    ALWAYS_ASSERT(it != _areaConfigurationIndex.end(),
                   "Configurable Element " << pConfigurableElement->getName()
                                           << " not found in Domain Configuration list");
-    return *it;
+    return *it->second;
 }
 
 CDomainConfiguration::AreaConfigurations::iterator CDomainConfiguration::
     findAreaConfigurationByPath(const std::string &configurableElementPath)
 {
-    auto areaConfiguration =
-        find_if(begin(mAreaConfigurationList), end(mAreaConfigurationList),
-                [&](const AreaConfiguration &conf) {
-                    return conf->getConfigurableElement()->getPath() == configurableElementPath;
-                });
-    return areaConfiguration;
+    // Configurations always belong to a domain
+    const auto *pDomain = static_cast<const CConfigurableDomain *>(getParent());
+    assert(pDomain != nullptr);
+
+    auto it =
+        _areaConfigurationIndex.find(pDomain->findConfigurableElement(configurableElementPath));
+
+    return it != _areaConfigurationIndex.end() ? it->second : end(mAreaConfigurationList);
 }
 
 // Rule
@@ -506,4 +715,6 @@ void CDomainConfiguration::setRule(CCompoundRule *pRule)
         // Chain
         addChild(pRule);
     }
+
+    compileApplicationRule();
 }
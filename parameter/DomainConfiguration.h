@@ -30,20 +30,29 @@
 #pragma once
 
 #include "AreaConfiguration.h"
+#include "RuleProgram.h"
 #include "XmlDomainImportContext.h"
 #include "XmlDomainExportContext.h"
 #include "Element.h"
 #include "Results.h"
 #include <list>
+#include <set>
 #include <string>
+#include <unordered_map>
 #include <memory>
+#include <vector>
+#include <cstdint>
 
 class CConfigurableElement;
 class CParameterBlackboard;
 class CConfigurationAccessContext;
 class CCompoundRule;
 class CSyncerSet;
+class CBlackboardStore;
+class CBlackboardUsage;
+class CBinaryStream;
 class CSelectionCriteriaDefinition;
+class CSelectionCriterion;
 
 class CDomainConfiguration : public CElement
 {
@@ -71,6 +80,26 @@ public:
     bool setElementSequence(const std::vector<std::string> &newElementSequence, std::string &error);
     void getElementSequence(std::string &strResult) const;
 
+    /** Gather all area blackboards into a single contiguous storage, in element sequence order
+     *
+     * Keeps restoration walking memory linearly. Must be called again once areas have been added
+     * or reordered for the layout to stay contiguous. Areas sharing deduplicated settings keep
+     * their shared storage.
+     */
+    void packAreaConfigurations();
+
+    /** Deduplicate area settings against the ones previously handed to the store
+     *
+     * @param[in,out] store the deduplicating store
+     */
+    void shareSettings(CBlackboardStore &store);
+
+    /** Account for area settings memory
+     *
+     * @param[in,out] usage the memory usage to update
+     */
+    void accountSettings(CBlackboardUsage &usage) const;
+
     // Application rule
     bool setApplicationRule(const std::string &strApplicationRule,
                             const CSelectionCriteriaDefinition *pSelectionCriteriaDefinition,
@@ -78,6 +107,13 @@ public:
     void clearApplicationRule();
     std::string getApplicationRule() const;
 
+    /** Compile the application rule for fast applicability checking
+     *
+     * Must be called once the rule has been created by other means than setApplicationRule
+     * (i.e. XML parsing).
+     */
+    void compileApplicationRule();
+
     // Get Blackboard for an element of the domain
     CParameterBlackboard *getBlackboard(const CConfigurableElement *pConfigurableElement) const;
 
@@ -94,6 +130,19 @@ public:
     bool restore(CParameterBlackboard *pMainBlackboard, bool bSync,
                  core::Results *errors = nullptr) const;
 
+    /** Restore the configuration areas differing from the main blackboard
+     *
+     * Areas matching the main blackboard content and not pending synchronization are neither
+     * copied nor contributed to the syncer set.
+     *
+     * @param[in] pMainBlackboard the application main blackboard
+     * @param[in,out] syncerSet set the syncers of restored areas are added to
+     * @param[in,out] copiedAreas incremented by the number of restored areas
+     * @param[in,out] skippedAreas incremented by the number of skipped areas
+     */
+    void restoreDifferences(CParameterBlackboard *pMainBlackboard, CSyncerSet &syncerSet,
+                            size_t &copiedAreas, size_t &skippedAreas) const;
+
     // Ensure validity for configurable element area configuration
     void validate(const CConfigurableElement *pConfigurableElement,
                   const CParameterBlackboard *pMainBlackboard);
@@ -109,6 +158,8 @@ public:
     void validateAgainst(const CDomainConfiguration *validDomainConfiguration);
     // Applicability checking
     bool isApplicable() const;
+    // Gather selection criteria the application rule depends on
+    void gatherCriteria(std::set<const CSelectionCriterion *> &criteria) const;
     // Merge existing configurations to given configurable element ones
     void merge(CConfigurableElement *pToConfigurableElement,
                CConfigurableElement *pFromConfigurableElement);
@@ -121,6 +172,15 @@ public:
     void composeSettings(CXmlElement &xmlConfigurationSettingsElement,
                          CXmlDomainExportContext &context) const;
 
+    /** Binary serializing of the application rule and of area settings
+     *
+     * The configuration name and the configurable elements are serialized by the domain.
+     */
+    void binarySerialize(CBinaryStream &binaryStream) const;
+    bool binaryDeserialize(CBinaryStream &binaryStream,
+                           const CSelectionCriteriaDefinition *pSelectionCriteriaDefinition,
+                           std::string &strError);
+
     // Class kind
     std::string getKind() const override;
 
@@ -144,6 +204,9 @@ private:
 
     /**
      * Returns the AreaConfiguration iterator associated to the Element refered by its path
+     *
+     * The path is resolved through the element index of the belonging domain.
+     *
      * @param[in] configurableElementPath to check if found in current list of areaconfigurations
      * @return iterator on the configuration associated to the Element with the given path,
      *                  last if not found
@@ -157,4 +220,14 @@ private:
     void setRule(CCompoundRule *pRule);
 
     AreaConfigurations mAreaConfigurationList;
+
+    /** Area configurations by element, list iterators remaining valid across reordering */
+    std::unordered_map<const CConfigurableElement *, AreaConfigurations::iterator>
+        _areaConfigurationIndex;
+
+    /** Storage of all area blackboards, see packAreaConfigurations() */
+    std::vector<uint8_t> _areaStorage;
+
+    /** Compiled application rule */
+    CRuleProgram _ruleProgram;
 };
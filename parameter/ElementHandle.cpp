@@ -215,7 +215,7 @@ bool ElementHandle::setAs(const T value, string &error) const
     T copy = value;
 
     // Ensure we're safe against blackboard foreign access
-    lock_guard<mutex> autoLock(mParameterMgr.getBlackboardMutex());
+    CParameterMgr::CBlackboardWriteLock autoLock(mParameterMgr);
 
     return parameter.access(copy, true, parameterAccessContext);
 }
@@ -229,10 +229,12 @@ bool ElementHandle::getAs(T &value, string &error) const
     // Safe downcast thanks to isParameter check in checkGetValidity
     auto &parameter = static_cast<const CBaseParameter &>(mElement);
 
-    // Ensure we're safe against blackboard foreign access
-    lock_guard<mutex> autoLock(mParameterMgr.getBlackboardMutex());
+    // Read from an immutable snapshot, safe against blackboard foreign access without locking
+    std::shared_ptr<const CParameterBlackboard> snapshot =
+        mParameterMgr.getParameterBlackboardSnapshot();
 
-    CParameterAccessContext parameterAccessContext(error, mParameterMgr.getParameterBlackboard());
+    CParameterAccessContext parameterAccessContext(
+        error, const_cast<CParameterBlackboard *>(snapshot.get()));
 
     return parameter.access(value, false, parameterAccessContext);
 }
@@ -29,12 +29,18 @@
  */
 #include "HardwareBackSynchronizer.h"
 #include "ConfigurableElement.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
 
 #define base CBackSynchronizer
 
 CHardwareBackSynchronizer::CHardwareBackSynchronizer(
-    const CConfigurableElement *pConfigurableElement, CParameterBlackboard *pParameterBlackboard)
-    : base(pConfigurableElement), _pParameterBlackboard(pParameterBlackboard)
+    const CConfigurableElement *pConfigurableElement, CParameterBlackboard *pParameterBlackboard,
+    size_t maxThreads)
+    : base(pConfigurableElement), _pParameterBlackboard(pParameterBlackboard),
+      _maxThreads(maxThreads)
 {
     // Fill back syncer set
     std::list<const CConfigurableElement *>::const_iterator it;
@@ -50,6 +56,36 @@ CHardwareBackSynchronizer::CHardwareBackSynchronizer(
 // Back synchronization
 void CHardwareBackSynchronizer::sync()
 {
-    // Perform back synchronization
-    _backSyncerSet.sync(*_pParameterBlackboard, true, nullptr);
+    if (_maxThreads <= 1) {
+
+        // Perform back synchronization
+        _backSyncerSet.sync(*_pParameterBlackboard, true, nullptr);
+        return;
+    }
+
+    // Subsystems are independent, hand them out to a bounded set of threads
+    const std::vector<CSyncerSet> subsystemSyncerSets = _backSyncerSet.splitByBatchSyncer();
+    std::atomic<size_t> next{0};
+
+    auto backSynchronize = [&] {
+        for (size_t index = next++; index < subsystemSyncerSets.size(); index = next++) {
+
+            subsystemSyncerSets[index].sync(*_pParameterBlackboard, true, nullptr);
+        }
+    };
+
+    // The calling thread takes its share
+    size_t threads = std::min(_maxThreads, subsystemSyncerSets.size());
+    std::vector<std::thread> workers;
+
+    for (size_t thread = 1; thread < threads; thread++) {
+
+        workers.emplace_back(backSynchronize);
+    }
+    backSynchronize();
+
+    for (auto &worker : workers) {
+
+        worker.join();
+    }
 }
@@ -35,8 +35,15 @@
 class CHardwareBackSynchronizer : public CBackSynchronizer
 {
 public:
+    /**
+     * @param[in] pConfigurableElement the element to back synchronize
+     * @param[in] pParameterBlackboard the blackboard to back synchronize
+     * @param[in] maxThreads the maximum number of threads back synchronizing distinct
+     *                       subsystems concurrently, each subsystem being synchronized in order
+     *                       by a single thread
+     */
     CHardwareBackSynchronizer(const CConfigurableElement *pConfigurableElement,
-                              CParameterBlackboard *pParameterBlackboard);
+                              CParameterBlackboard *pParameterBlackboard, size_t maxThreads = 1);
 
     // Back synchronization
     void sync() override;
@@ -46,4 +53,6 @@ private:
     CSyncerSet _backSyncerSet;
     // Parameter blackboard
     CParameterBlackboard *_pParameterBlackboard;
+    // Back synchronization parallelism
+    size_t _maxThreads;
 };
@@ -33,6 +33,7 @@
 #include "Syncer.h"
 #include "TypeElement.h"
 #include "ParameterAccessContext.h"
+#include "ParameterBlackboard.h"
 #include <assert.h>
 
 #define base CConfigurableElement
@@ -190,12 +191,22 @@ bool CInstanceConfigurableElement::sync(CParameterAccessContext &parameterAccess
     }
     std::string strError;
 
-    if (!pSyncer->sync(*parameterAccessContext.getParameterBlackboard(), false, strError)) {
+    CParameterBlackboard *pBlackboard = parameterAccessContext.getParameterBlackboard();
+
+    if (!pSyncer->sync(*pBlackboard, false, strError)) {
 
         parameterAccessContext.setError(strError);
 
         return false;
     }
+    size_t offset;
+    size_t size;
+
+    // Synchronized, not to be synchronized again by the next configuration application
+    if (pSyncer->getBlackboardArea(offset, size)) {
+
+        pBlackboard->clearDirty(offset, size);
+    }
     return true;
 }
 
@@ -76,6 +76,7 @@ public:
     // Syncer to/from HW
     void setSyncer(ISyncer *pSyncer);
     void unsetSyncer();
+    ISyncer *getSyncer() const override;
 
     // Type
     virtual Type getType() const = 0;
@@ -96,8 +97,6 @@ public:
                         CXmlSerializingContext &serializingContext) const override;
 
 protected:
-    // Syncer
-    ISyncer *getSyncer() const override;
     // Syncer set (descendant)
     void fillSyncerSetFromDescendant(CSyncerSet &syncerSet) const override;
 
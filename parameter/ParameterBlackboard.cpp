@@ -31,16 +31,109 @@
 #include "Iterator.hpp"
 #include "AlwaysAssert.hpp"
 #include <algorithm>
+#include <functional>
+#include <tuple>
 
 // Size
 void CParameterBlackboard::setSize(size_t size)
 {
+    if (mData != mBlackboard.data()) {
+
+        // Back to owned storage
+        mBlackboard.assign(mData, mData + mSize);
+    }
     mBlackboard.resize(size);
+    mData = mBlackboard.data();
+    mSize = size;
+    mSharedStorage.reset();
+    ++mVersion;
+
+    if (mDirtyTracking) {
+
+        mDirty.resize(size, true);
+    }
 }
 
 size_t CParameterBlackboard::getSize() const
 {
-    return mBlackboard.size();
+    return mSize;
+}
+
+void CParameterBlackboard::setStorage(uint8_t *storage)
+{
+    std::copy_n(mData, mSize, MAKE_ARRAY_ITERATOR(storage, mSize));
+    mData = storage;
+    mSharedStorage.reset();
+
+    // Release owned storage
+    Blackboard().swap(mBlackboard);
+}
+
+const uint8_t *CParameterBlackboard::getStorage() const
+{
+    return mData;
+}
+
+void CParameterBlackboard::share(const SharedStorage &storage)
+{
+    ALWAYS_ASSERT(storage->size() == mSize && std::equal(begin(*storage), end(*storage),
+                                                         MAKE_ARRAY_ITERATOR(mData, mSize)),
+                  "Shared storage content differs from blackboard content");
+
+    // Never written through, see unshare()
+    mData = const_cast<uint8_t *>(storage->data());
+    mSharedStorage = storage;
+
+    Blackboard().swap(mBlackboard);
+}
+
+const CParameterBlackboard::SharedStorage &CParameterBlackboard::getSharedStorage() const
+{
+    return mSharedStorage;
+}
+
+void CParameterBlackboard::unshare()
+{
+    if (mSharedStorage != nullptr) {
+
+        mBlackboard.assign(mData, mData + mSize);
+        mData = mBlackboard.data();
+        mSharedStorage.reset();
+    }
+}
+
+// Tracked write
+template <class InputIterator>
+void CParameterBlackboard::write(InputIterator first, size_t size, size_t offset)
+{
+    unshare();
+
+    auto dest = atOffset(offset);
+
+    ++mVersion;
+
+    if (!mDirtyTracking) {
+
+        std::copy_n(first, size, MAKE_ARRAY_ITERATOR(dest, size));
+        return;
+    }
+
+    // Only flag actually changed bytes
+    auto last = first + size;
+
+    while (first != last) {
+
+        // Skip unchanged bytes
+        std::tie(first, dest) = std::mismatch(first, last, dest);
+
+        // Then copy the following run of changed bytes
+        auto runLast = std::mismatch(first, last, dest, std::not_equal_to<uint8_t>()).first;
+        auto runSize = static_cast<size_t>(runLast - first);
+
+        std::fill_n(begin(mDirty) + (dest - mData), runSize, true);
+        dest = std::copy(first, runLast, dest);
+        first = runLast;
+    }
 }
 
 // Single parameter access
@@ -48,11 +141,7 @@ void CParameterBlackboard::writeInteger(const void *pvSrcData, size_t size, size
 {
     assertValidAccess(offset, size);
 
-    auto first = MAKE_ARRAY_ITERATOR(static_cast<const uint8_t *>(pvSrcData), size);
-    auto last = first + size;
-    auto dest_first = atOffset(offset);
-
-    std::copy(first, last, dest_first);
+    write(MAKE_ARRAY_ITERATOR(static_cast<const uint8_t *>(pvSrcData), size), size, offset);
 }
 
 void CParameterBlackboard::readInteger(void *pvDstData, size_t size, size_t offset) const
@@ -70,8 +159,8 @@ void CParameterBlackboard::writeString(const std::string &input, size_t offset)
 {
     assertValidAccess(offset, input.size() + 1);
 
-    auto dest_last = std::copy(begin(input), end(input), atOffset(offset));
-    *dest_last = '\0';
+    // Null terminated
+    write(reinterpret_cast<const uint8_t *>(input.c_str()), input.size() + 1, offset);
 }
 
 void CParameterBlackboard::readString(std::string &output, size_t offset) const
@@ -81,7 +170,7 @@ void CParameterBlackboard::readString(std::string &output, size_t offset) const
     assertValidAccess(offset, sizeof('\0'));
 
     // Get the pointer to the null terminated string
-    const uint8_t *first = &mBlackboard[offset];
+    const uint8_t *first = atOffset(offset);
     output = reinterpret_cast<const char *>(first);
 }
 
@@ -99,7 +188,7 @@ void CParameterBlackboard::writeBytes(const std::vector<uint8_t> &bytes, size_t
 {
     assertValidAccess(offset, bytes.size());
 
-    std::copy(begin(bytes), end(bytes), atOffset(offset));
+    write(begin(bytes), bytes.size(), offset);
 }
 
 void CParameterBlackboard::readBytes(std::vector<uint8_t> &bytes, size_t offset) const
@@ -113,22 +202,83 @@ void CParameterBlackboard::readBytes(std::vector<uint8_t> &bytes, size_t offset)
 uint8_t *CParameterBlackboard::getLocation(size_t offset)
 {
     assertValidAccess(offset, 1);
-    return &mBlackboard[offset];
+
+    // Subsystems may write through the returned location
+    unshare();
+
+    return atOffset(offset);
+}
+
+void CParameterBlackboard::setModified()
+{
+    ++mVersion;
 }
 
 // Configuration handling
 void CParameterBlackboard::restoreFrom(const CParameterBlackboard *pFromBlackboard, size_t offset)
 {
-    const auto &fromBB = pFromBlackboard->mBlackboard;
-    assertValidAccess(offset, fromBB.size());
-    std::copy(begin(fromBB), end(fromBB), atOffset(offset));
+    size_t size = pFromBlackboard->getSize();
+    assertValidAccess(offset, size);
+    write(MAKE_ARRAY_ITERATOR(pFromBlackboard->atOffset(0), size), size, offset);
 }
 
 void CParameterBlackboard::saveTo(CParameterBlackboard *pToBlackboard, size_t offset) const
 {
-    auto &toBB = pToBlackboard->mBlackboard;
-    assertValidAccess(offset, toBB.size());
-    std::copy_n(atOffset(offset), toBB.size(), begin(toBB));
+    size_t size = pToBlackboard->getSize();
+    assertValidAccess(offset, size);
+    pToBlackboard->unshare();
+    std::copy_n(atOffset(offset), size, MAKE_ARRAY_ITERATOR(pToBlackboard->atOffset(0), size));
+}
+
+bool CParameterBlackboard::matches(const CParameterBlackboard *pFromBlackboard,
+                                   size_t offset) const
+{
+    size_t size = pFromBlackboard->getSize();
+    assertValidAccess(offset, size);
+    const uint8_t *first = pFromBlackboard->atOffset(0);
+    return std::equal(first, first + size, MAKE_ARRAY_ITERATOR(atOffset(offset), size));
+}
+
+uint64_t CParameterBlackboard::getVersion() const
+{
+    return mVersion;
+}
+
+// Dirty tracking
+void CParameterBlackboard::enableDirtyTracking()
+{
+    mDirtyTracking = true;
+    mDirty.assign(getSize(), true);
+}
+
+bool CParameterBlackboard::isDirty(size_t offset, size_t size) const
+{
+    if (!mDirtyTracking) {
+
+        return true;
+    }
+    assertValidAccess(offset, size);
+
+    auto first = begin(mDirty) + offset;
+    return std::find(first, first + size, true) != first + size;
+}
+
+void CParameterBlackboard::setDirty(size_t offset, size_t size)
+{
+    if (mDirtyTracking) {
+
+        assertValidAccess(offset, size);
+        std::fill_n(begin(mDirty) + offset, size, true);
+    }
+}
+
+void CParameterBlackboard::clearDirty(size_t offset, size_t size)
+{
+    if (mDirtyTracking) {
+
+        assertValidAccess(offset, size);
+        std::fill_n(begin(mDirty) + offset, size, false);
+    }
 }
 
 void CParameterBlackboard::assertValidAccess(size_t offset, size_t size) const
@@ -31,7 +31,9 @@
 
 #include "NonCopyable.hpp"
 
+#include <atomic>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -42,6 +44,33 @@ public:
     void setSize(size_t size);
     size_t getSize() const;
 
+    /** Move the content to externally owned storage
+     *
+     * Allows several blackboards to share a single contiguous allocation. The storage must hold
+     * at least getSize() bytes and outlive its use by the blackboard, which ends on the next
+     * setStorage() or setSize() call.
+     *
+     * @param[in] storage the storage to copy the current content to
+     */
+    void setStorage(uint8_t *storage);
+
+    /** @return the current storage, owned, external or shared, see setStorage() and share() */
+    const uint8_t *getStorage() const;
+
+    /** Storage shared between blackboards of identical content */
+    using SharedStorage = std::shared_ptr<const std::vector<uint8_t>>;
+
+    /** Rely on immutable storage shared with other blackboards
+     *
+     * Storage is copied back to the blackboard on its first modification (copy on write).
+     *
+     * @param[in] storage the shared storage, which must hold the current content
+     */
+    void share(const SharedStorage &storage);
+
+    /** @return the shared storage the blackboard relies on, if any, nullptr otherwise */
+    const SharedStorage &getSharedStorage() const;
+
     // Single parameter access
     void writeInteger(const void *pvSrcData, size_t size, size_t offset);
     void readInteger(void *pvDstData, size_t size, size_t offset) const;
@@ -82,19 +111,90 @@ public:
      */
     void readBytes(std::vector<uint8_t> &bytes, size_t offset) const;
 
-    // Access from/to subsystems
+    /** Access from/to subsystems
+     *
+     * Writes through the returned location are neither tracked as dirty nor counted by the
+     * modification counter: call setModified() once done.
+     */
     uint8_t *getLocation(size_t offset);
 
+    /** Count a modification made through getLocation(), e.g. a back synchronization */
+    void setModified();
+
     // Configuration handling
     void restoreFrom(const CParameterBlackboard *pFromBlackboard, size_t offset);
     void saveTo(CParameterBlackboard *pToBlackboard, size_t offset) const;
 
+    /** Compare an area with the whole content of another blackboard
+     *
+     * @param[in] pFromBlackboard the blackboard to compare with
+     * @param[in] offset the area offset in this blackboard
+     * @return true if contents are identical, false otherwise
+     */
+    bool matches(const CParameterBlackboard *pFromBlackboard, size_t offset) const;
+
+    /** Get the modification counter
+     *
+     * The counter is incremented by each write access and each setModified() call, so that an
+     * unchanged counter guarantees unchanged content.
+     *
+     * @return the modification counter
+     */
+    uint64_t getVersion() const;
+
+    /** Track modified bytes
+     *
+     * Once enabled, the bytes actually changed by write and restore accesses are flagged as
+     * dirty until cleared, typically once synchronized. All bytes are initially dirty.
+     * Bytes written through getLocation() are not tracked.
+     */
+    void enableDirtyTracking();
+
+    /** Check whether an area holds dirty bytes
+     *
+     * @param[in] offset the area offset
+     * @param[in] size the area size
+     * @return true if any byte of the area is dirty or if tracking is disabled, false otherwise
+     */
+    bool isDirty(size_t offset, size_t size) const;
+
+    /** Flag an area as dirty, whether its bytes have changed or not */
+    void setDirty(size_t offset, size_t size);
+
+    /** Flag an area as clean, i.e. as synchronized */
+    void clearDirty(size_t offset, size_t size);
+
 private:
     void assertValidAccess(size_t offset, size_t size) const;
 
+    /** Copy shared storage, if any, to owned storage ahead of a modification */
+    void unshare();
+
+    /** Copy bytes to the blackboard, flagging as dirty the ones that changed
+     *
+     * Each run of changed bytes is copied and flagged at once.
+     */
+    template <class InputIterator>
+    void write(InputIterator first, size_t size, size_t offset);
+
     using Blackboard = std::vector<uint8_t>;
+    /** Owned storage, unused while relying on external storage */
     Blackboard mBlackboard;
 
-    Blackboard::iterator atOffset(size_t offset) { return begin(mBlackboard) + offset; }
-    Blackboard::const_iterator atOffset(size_t offset) const { return begin(mBlackboard) + offset; }
+    /** Current storage, either owned or external */
+    uint8_t *mData{nullptr};
+    size_t mSize{0};
+
+    /** Shared storage mData points to, if any */
+    SharedStorage mSharedStorage;
+
+    /** Dirty flag of each blackboard byte, one byte per flag to allow concurrent updates of
+     * distinct areas. */
+    std::vector<uint8_t> mDirty;
+    bool mDirtyTracking{false};
+
+    std::atomic<uint64_t> mVersion{0};
+
+    uint8_t *atOffset(size_t offset) { return mData + offset; }
+    const uint8_t *atOffset(size_t offset) const { return mData + offset; }
 };
@@ -59,6 +59,18 @@ uint16_t CParameterFrameworkConfiguration::getServerPort() const
     return _uiServerPort;
 }
 
+// Server Unix domain socket path
+const std::string &CParameterFrameworkConfiguration::getServerSocketPath() const
+{
+    return _strServerSocketPath;
+}
+
+// Back synchronization parallelism
+size_t CParameterFrameworkConfiguration::getBackSynchronizationThreads() const
+{
+    return _backSynchronizationThreads;
+}
+
 // From IXmlSink
 bool CParameterFrameworkConfiguration::fromXml(const CXmlElement &xmlElement,
                                                CXmlSerializingContext &serializingContext)
@@ -72,6 +84,12 @@ bool CParameterFrameworkConfiguration::fromXml(const CXmlElement &xmlElement,
     // Server port
     xmlElement.getAttribute("ServerPort", _uiServerPort);
 
+    // Server Unix domain socket path, taking precedence over the port
+    xmlElement.getAttribute("ServerSocketPath", _strServerSocketPath);
+
+    // Back synchronization parallelism, sequential if not positive
+    xmlElement.getAttribute("BackSynchronizationThreads", _backSynchronizationThreads);
+
     // Base
     return base::fromXml(xmlElement, serializingContext);
 }
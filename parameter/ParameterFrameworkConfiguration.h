@@ -45,6 +45,13 @@ public:
     // Server port
     uint16_t getServerPort() const;
 
+    /** @return the path of the Unix domain socket to listen on instead of the server port,
+     *          empty to listen on the server port */
+    const std::string &getServerSocketPath() const;
+
+    /** @return the maximum number of threads back synchronizing subsystems at start */
+    size_t getBackSynchronizationThreads() const;
+
     // From IXmlSink
     bool fromXml(const CXmlElement &xmlElement,
                  CXmlSerializingContext &serializingContext) override;
@@ -59,4 +66,8 @@ private:
     bool _bTuningAllowed{false};
     // Server port
     uint16_t _uiServerPort{0};
+    // Server Unix domain socket path
+    std::string _strServerSocketPath;
+    // Back synchronization parallelism
+    size_t _backSynchronizationThreads{1};
 };
@@ -80,14 +80,18 @@
 #include "EnumValuePair.h"
 #include "Subsystem.h"
 #include "XmlStreamDocSink.h"
+#include "XmlStreamWriter.h"
 #include "XmlMemoryDocSink.h"
 #include "XmlDocSource.h"
 #include "XmlMemoryDocSource.h"
 #include "SelectionCriteriaDefinition.h"
 #include "Utility.h"
 #include "Memory.hpp"
+#include "BinaryStream.h"
 #include <sstream>
 #include <fstream>
+#include <cstdio>
+#include <iterator>
 #include <algorithm>
 #include <stdexcept>
 #include <mutex>
@@ -150,175 +154,178 @@ typedef IRemoteProcessorServerInterface *(*CreateRemoteProcessorServer)(
 const CParameterMgr::SRemoteCommandParserItem CParameterMgr::gastRemoteCommandParserItems[] = {
 
     /// Version
-    {"version", &CParameterMgr::versionCommandProcess, 0, "", "Show version"},
+    {"version", &CParameterMgr::versionCommandProcess, 0, "", "Show version", true},
 
     /// Status
-    {"status", &CParameterMgr::statusCommandProcess, 0, "", "Show current status"},
+    {"status", &CParameterMgr::statusCommandProcess, 0, "", "Show current status", false},
 
     /// Tuning Mode
     {"setTuningMode", &CParameterMgr::setTuningModeCommandProcess, 1, "on|off*",
-     "Turn on or off Tuning Mode"},
-    {"getTuningMode", &CParameterMgr::getTuningModeCommandProcess, 0, "", "Show Tuning Mode"},
+     "Turn on or off Tuning Mode", false},
+    {"getTuningMode", &CParameterMgr::getTuningModeCommandProcess, 0, "", "Show Tuning Mode", true},
 
     /// Value Space
     {"setValueSpace", &CParameterMgr::setValueSpaceCommandProcess, 1, "raw|real*",
-     "Assigns Value Space used for parameter value interpretation"},
-    {"getValueSpace", &CParameterMgr::getValueSpaceCommandProcess, 0, "", "Show Value Space"},
+     "Assigns Value Space used for parameter value interpretation", false},
+    {"getValueSpace", &CParameterMgr::getValueSpaceCommandProcess, 0, "", "Show Value Space", true},
 
     /// Output Raw Format
     {"setOutputRawFormat", &CParameterMgr::setOutputRawFormatCommandProcess, 1, "dec*|hex",
-     "Assigns format used to output parameter values when in raw Value Space"},
+     "Assigns format used to output parameter values when in raw Value Space", false},
     {"getOutputRawFormat", &CParameterMgr::getOutputRawFormatCommandProcess, 0, "",
-     "Show Output Raw Format"},
+     "Show Output Raw Format", true},
 
     /// Sync
     {"setAutoSync", &CParameterMgr::setAutoSyncCommandProcess, 1, "on*|off",
-     "Turn on or off automatic synchronization to hardware while in Tuning Mode"},
-    {"getAutoSync", &CParameterMgr::getAutoSyncCommandProcess, 0, "", "Show Auto Sync state"},
+     "Turn on or off automatic synchronization to hardware while in Tuning Mode", false},
+    {"getAutoSync", &CParameterMgr::getAutoSyncCommandProcess, 0, "", "Show Auto Sync state", true},
     {"sync", &CParameterMgr::syncCommandProcess, 0, "",
-     "Synchronize current settings to hardware while in Tuning Mode and Auto Sync off"},
+     "Synchronize current settings to hardware while in Tuning Mode and Auto Sync off", false},
 
     /// Criteria
     {"listCriteria", &CParameterMgr::listCriteriaCommandProcess, 0, "[CSV|XML]",
-     "List selection criteria"},
+     "List selection criteria", true},
 
     /// Domains
-    {"listDomains", &CParameterMgr::listDomainsCommandProcess, 0, "", "List configurable domains"},
+    {"listDomains", &CParameterMgr::listDomainsCommandProcess, 0, "", "List configurable domains",
+     true},
     {"dumpDomains", &CParameterMgr::dumpDomainsCommandProcess, 0, "",
-     "Show all domains and configurations, including applicability conditions"},
+     "Show all domains and configurations, including applicability conditions", false},
     {"createDomain", &CParameterMgr::createDomainCommandProcess, 1, "<domain>",
-     "Create new configurable domain"},
+     "Create new configurable domain", false},
     {"deleteDomain", &CParameterMgr::deleteDomainCommandProcess, 1, "<domain>",
-     "Delete configurable domain"},
+     "Delete configurable domain", false},
     {"deleteAllDomains", &CParameterMgr::deleteAllDomainsCommandProcess, 0, "",
-     "Delete all configurable domains"},
+     "Delete all configurable domains", false},
     {"renameDomain", &CParameterMgr::renameDomainCommandProcess, 2, "<domain> <new name>",
-     "Rename configurable domain"},
+     "Rename configurable domain", false},
     {"setSequenceAwareness", &CParameterMgr::setSequenceAwarenessCommandProcess, 1,
-     "<domain> true|false*", "Set configurable domain sequence awareness"},
+     "<domain> true|false*", "Set configurable domain sequence awareness", false},
     {"getSequenceAwareness", &CParameterMgr::getSequenceAwarenessCommandProcess, 1, "<domain>",
-     "Get configurable domain sequence awareness"},
+     "Get configurable domain sequence awareness", true},
     {"listDomainElements", &CParameterMgr::listDomainElementsCommandProcess, 1, "<domain>",
-     "List elements associated to configurable domain"},
+     "List elements associated to configurable domain", true},
     {"addElement", &CParameterMgr::addElementCommandProcess, 2, "<domain> <elem path>",
-     "Associate element at given path to configurable domain"},
+     "Associate element at given path to configurable domain", false},
     {"removeElement", &CParameterMgr::removeElementCommandProcess, 2, "<domain> <elem path>",
-     "Dissociate element at given path from configurable domain"},
+     "Dissociate element at given path from configurable domain", false},
     {"splitDomain", &CParameterMgr::splitDomainCommandProcess, 2, "<domain> <elem path>",
-     "Split configurable domain at given associated element path"},
+     "Split configurable domain at given associated element path", false},
 
     /// Configurations
     {"listConfigurations", &CParameterMgr::listConfigurationsCommandProcess, 1, "<domain>",
-     "List domain configurations"},
+     "List domain configurations", true},
     {"createConfiguration", &CParameterMgr::createConfigurationCommandProcess, 2,
-     "<domain> <configuration>", "Create new domain configuration"},
+     "<domain> <configuration>", "Create new domain configuration", false},
     {"deleteConfiguration", &CParameterMgr::deleteConfigurationCommandProcess, 2,
-     "<domain> <configuration>", "Delete domain configuration"},
+     "<domain> <configuration>", "Delete domain configuration", false},
     {"renameConfiguration", &CParameterMgr::renameConfigurationCommandProcess, 3,
-     "<domain> <configuration> <new name>", "Rename domain configuration"},
+     "<domain> <configuration> <new name>", "Rename domain configuration", false},
     {"saveConfiguration", &CParameterMgr::saveConfigurationCommandProcess, 2,
-     "<domain> <configuration>", "Save current settings into configuration"},
+     "<domain> <configuration>", "Save current settings into configuration", false},
     {"restoreConfiguration", &CParameterMgr::restoreConfigurationCommandProcess, 2,
-     "<domain> <configuration>", "Restore current settings from configuration"},
+     "<domain> <configuration>", "Restore current settings from configuration", false},
     {"setElementSequence", &CParameterMgr::setElementSequenceCommandProcess, 3,
      "<domain> <configuration> <elem path list>",
-     "Set element application order for configuration"},
+     "Set element application order for configuration", false},
     {"getElementSequence", &CParameterMgr::getElementSequenceCommandProcess, 2,
-     "<domain> <configuration>", "Get element application order for configuration"},
+     "<domain> <configuration>", "Get element application order for configuration", true},
     {"setRule", &CParameterMgr::setRuleCommandProcess, 3, "<domain> <configuration> <rule>",
-     "Set configuration application rule"},
+     "Set configuration application rule", false},
     {"clearRule", &CParameterMgr::clearRuleCommandProcess, 2, "<domain> <configuration>",
-     "Clear configuration application rule"},
+     "Clear configuration application rule", false},
     {"getRule", &CParameterMgr::getRuleCommandProcess, 2, "<domain> <configuration>",
-     "Get configuration application rule"},
+     "Get configuration application rule", true},
+    {"showSettingsUsage", &CParameterMgr::showSettingsUsageCommandProcess, 0, "",
+     "Show memory used by configuration settings and deduplication ratio", false},
 
     /// Elements/Parameters
     {"listElements", &CParameterMgr::listElementsCommandProcess, 1, "<elem path>|/",
-     "List elements under element at given path or root"},
+     "List elements under element at given path or root", true},
     {"listParameters", &CParameterMgr::listParametersCommandProcess, 1, "<elem path>|/",
-     "List parameters under element at given path or root"},
+     "List parameters under element at given path or root", true},
     {"getElementStructureXML", &CParameterMgr::getElementStructureXMLCommandProcess, 1,
-     "<elem path>", "Get structure of element at given path in XML format"},
+     "<elem path>", "Get structure of element at given path in XML format", true},
     {"getElementBytes", &CParameterMgr::getElementBytesCommandProcess, 1, "<elem path>",
-     "Get settings of element at given path in Byte Array format"},
+     "Get settings of element at given path in Byte Array format", true},
     {"setElementBytes", &CParameterMgr::setElementBytesCommandProcess, 2, "<elem path> <values>",
-     "Set settings of element at given path in Byte Array format"},
+     "Set settings of element at given path in Byte Array format", false},
     {"getElementXML", &CParameterMgr::getElementXMLCommandProcess, 1, "<elem path>",
-     "Get settings of element at given path in XML format"},
+     "Get settings of element at given path in XML format", true},
     {"setElementXML", &CParameterMgr::setElementXMLCommandProcess, 2, "<elem path> <values>",
-     "Set settings of element at given path in XML format"},
+     "Set settings of element at given path in XML format", false},
     {"dumpElement", &CParameterMgr::dumpElementCommandProcess, 1, "<elem path>",
-     "Dump structure and content of element at given path"},
+     "Dump structure and content of element at given path", false},
     {"getElementSize", &CParameterMgr::getElementSizeCommandProcess, 1, "<elem path>",
-     "Show size of element at given path"},
+     "Show size of element at given path", true},
     {"showProperties", &CParameterMgr::showPropertiesCommandProcess, 1, "<elem path>",
-     "Show properties of element at given path"},
+     "Show properties of element at given path", true},
     {"getParameter", &CParameterMgr::getParameterCommandProcess, 1, "<param path>",
-     "Get value for parameter at given path"},
+     "Get value for parameter at given path", true},
     {"setParameter", &CParameterMgr::setParameterCommandProcess, 2, "<param path> <value>",
-     "Set value for parameter at given path"},
+     "Set value for parameter at given path", false},
     {"listBelongingDomains", &CParameterMgr::listBelongingDomainsCommandProcess, 1, "<elem path>",
-     "List domain(s) element at given path belongs to"},
+     "List domain(s) element at given path belongs to", true},
     {"listAssociatedDomains", &CParameterMgr::listAssociatedDomainsCommandProcess, 1, "<elem path>",
-     "List domain(s) element at given path is associated to"},
+     "List domain(s) element at given path is associated to", true},
     {"getConfigurationParameter", &CParameterMgr::getConfigurationParameterCommandProcess, 3,
      "<domain> <configuration> <param path>",
-     "Get value for parameter at given path from configuration"},
+     "Get value for parameter at given path from configuration", false},
     {"setConfigurationParameter", &CParameterMgr::setConfigurationParameterCommandProcess, 4,
      "<domain> <configuration> <param path> <value>",
-     "Set value for parameter at given path to configuration"},
+     "Set value for parameter at given path to configuration", false},
     {"showMapping", &CParameterMgr::showMappingCommandProcess, 1, "<elem path>",
-     "Show mapping for an element at given path"},
+     "Show mapping for an element at given path", true},
 
     /// Browse
     {"listAssociatedElements", &CParameterMgr::listAssociatedElementsCommandProcess, 0, "",
-     "List element sub-trees associated to at least one configurable domain"},
+     "List element sub-trees associated to at least one configurable domain", true},
     {"listConflictingElements", &CParameterMgr::listConflictingElementsCommandProcess, 0, "",
-     "List element sub-trees contained in more than one configurable domain"},
+     "List element sub-trees contained in more than one configurable domain", true},
     {"listRogueElements", &CParameterMgr::listRogueElementsCommandProcess, 0, "",
-     "List element sub-trees owned by no configurable domain"},
+     "List element sub-trees owned by no configurable domain", true},
 
     /// Settings Import/Export
     {"exportDomainsXML", &CParameterMgr::exportDomainsXMLCommandProcess, 1, "<file path> ",
      "Export domains to an XML file (provide an absolute path or relative"
-     "to the client's working directory)"},
+     "to the client's working directory)", false},
     {"importDomainsXML", &CParameterMgr::importDomainsXMLCommandProcess, 1, "<file path>",
      "Import domains from an XML file (provide an absolute path or relative"
-     "to the client's working directory)"},
+     "to the client's working directory)", false},
     {"exportDomainsWithSettingsXML", &CParameterMgr::exportDomainsWithSettingsXMLCommandProcess, 1,
      "<file path> ",
      "Export domains including settings to XML file (provide an absolute path or relative"
-     "to the client's working directory)"},
+     "to the client's working directory)", false},
     {"exportDomainWithSettingsXML", &CParameterMgr::exportDomainWithSettingsXMLCommandProcess, 2,
      "<domain> <file path> ", "Export a single given domain including settings to XML file"
                               " (provide an absolute path or relative to the client's"
-                              " working directory)"},
+                              " working directory)", false},
     {"importDomainsWithSettingsXML", &CParameterMgr::importDomainsWithSettingsXMLCommandProcess, 1,
      "<file path>",
      "Import domains including settings from XML file (provide an absolute path or relative"
-     "to the client's working directory)"},
+     "to the client's working directory)", false},
     {"importDomainWithSettingsXML", &CParameterMgr::importDomainWithSettingsXMLCommandProcess, 1,
      "<file path> [overwrite]",
      "Import a single domain including settings from XML file."
      " Does not overwrite an existing domain unless 'overwrite' is passed as second"
-     " argument. Provide an absolute path or relative to the client's working directory)"},
+     " argument. Provide an absolute path or relative to the client's working directory)", false},
     {"getDomainsWithSettingsXML", &CParameterMgr::getDomainsWithSettingsXMLCommandProcess, 0, "",
-     "Print domains including settings as XML"},
+     "Print domains including settings as XML", false},
     {"getDomainWithSettingsXML", &CParameterMgr::getDomainWithSettingsXMLCommandProcess, 1,
-     "<domain>", "Print the given domain including settings as XML"},
+     "<domain>", "Print the given domain including settings as XML", false},
     {"setDomainsWithSettingsXML", &CParameterMgr::setDomainsWithSettingsXMLCommandProcess, 1,
-     "<xml configurable domains>", "Import domains including settings from XML string"},
+     "<xml configurable domains>", "Import domains including settings from XML string", false},
     {"setDomainWithSettingsXML", &CParameterMgr::setDomainWithSettingsXMLCommandProcess, 1,
      "<xml configurable domain> [overwrite]",
      "Import domains including settings from XML"
      " string. Does not overwrite an existing domain unless 'overwrite' is passed as second"
-     " argument"},
+     " argument", false},
     /// Structure Export
     {"getSystemClassXML", &CParameterMgr::getSystemClassXMLCommandProcess, 0, "",
-     "Print parameter structure as XML"},
+     "Print parameter structure as XML", true},
     /// Deprecated Commands
     {"getDomainsXML", &CParameterMgr::getDomainsWithSettingsXMLCommandProcess, 0, "",
-     "DEPRECATED COMMAND, please use getDomainsWithSettingsXML"},
+     "DEPRECATED COMMAND, please use getDomainsWithSettingsXML", false},
 
 };
 
@@ -337,6 +344,9 @@ CParameterMgr::CParameterMgr(const string &strConfigurationFilePath, log::ILogge
 
 CParameterMgr::~CParameterMgr()
 {
+    // Drain subsystem synchronizations before destroying anything they may rely on
+    getSystemClass()->setAsynchronousSync(false);
+
     // Children
     delete _pRemoteProcessorServer;
     delete _pMainParameterBlackboard;
@@ -393,7 +403,9 @@ bool CParameterMgr::load(string &strError)
         LOG_CONTEXT("Main blackboard back synchronization");
 
         // Back synchronization for areas in parameter blackboard not covered by any domain
-        BackSynchronizer(getConstSystemClass(), _pMainParameterBlackboard).sync();
+        BackSynchronizer(getConstSystemClass(), _pMainParameterBlackboard,
+                         getConstFrameworkConfiguration()->getBackSynchronizationThreads())
+            .sync();
     }
 
     // We're done loading the settings and back synchronizing
@@ -402,6 +414,11 @@ bool CParameterMgr::load(string &strError)
     // We need to ensure all domains are valid
     pConfigurableDomains->validate(_pMainParameterBlackboard);
 
+    if (_bSettingsDeduplication) {
+
+        pConfigurableDomains->shareSettings();
+    }
+
     // Log selection criterion states
     {
         LOG_CONTEXT("Criterion states");
@@ -417,8 +434,16 @@ bool CParameterMgr::load(string &strError)
     // Subsystem can not ask for resync as they have not been synced yet
     getSystemClass()->cleanSubsystemsNeedToResync();
 
-    // At initialization, check subsystems that need resync
-    doApplyConfigurations(true);
+    // Back synchronization done, forward ones may now be asynchronous
+    getSystemClass()->setAsynchronousSync(_bAsynchronousSync);
+
+    {
+        // Publish the initial settings to readers
+        CBlackboardWriteLock autoLock(*this);
+
+        // At initialization, check subsystems that need resync
+        doApplyConfigurations(true);
+    }
 
     // Start remote processor server if appropriate
     return handleRemoteProcessingInterface(strError);
@@ -531,9 +556,15 @@ bool CParameterMgr::loadStructure(string &strError)
     // Initialize offsets
     pSystemClass->setOffset(0);
 
+    // Structure is complete, paths will not change anymore
+    pSystemClass->indexElementPaths();
+
     // Initialize main blackboard's size
     _pMainParameterBlackboard->setSize(pSystemClass->getFootPrint());
 
+    // Track changes so that configuration application only synchronizes modified areas
+    _pMainParameterBlackboard->enableDirtyTracking();
+
     return true;
 }
 
@@ -593,6 +624,16 @@ bool CParameterMgr::loadSettingsFromConfigFile(string &strError)
     string configurationDomainsUri =
         CXmlDocSource::mkUri(_xmlConfigurationUri, pConfigurableDomainsFileLocation->getUri());
 
+    // Binary cache, valid as long as the domains file, structure and criteria are unchanged
+    uint64_t digest = 0;
+    bool bCacheable =
+        !_settingsCacheLocation.empty() && digestSettingsInputs(configurationDomainsUri, digest);
+
+    if (bCacheable && loadSettingsCache(digest)) {
+
+        return true;
+    }
+
     // Parse configuration domains XML file
     CXmlDomainImportContext xmlDomainImportContext(strError, true, *getSystemClass());
 
@@ -612,8 +653,137 @@ bool CParameterMgr::loadSettingsFromConfigFile(string &strError)
         return false;
     }
 
-    return xmlParse(xmlDomainImportContext, pConfigurableDomains, doc, _xmlConfigurationUri,
-                    EParameterConfigurationLibrary, true, "SystemClassName");
+    if (!xmlParse(xmlDomainImportContext, pConfigurableDomains, doc, _xmlConfigurationUri,
+                  EParameterConfigurationLibrary, true, "SystemClassName")) {
+
+        return false;
+    }
+    if (bCacheable) {
+
+        storeSettingsCache(digest);
+    }
+    return true;
+}
+
+const char CParameterMgr::settingsCacheMagic[4] = {'P', 'F', 'W', 'S'};
+const uint32_t CParameterMgr::settingsCacheVersion;
+
+bool CParameterMgr::digestSettingsInputs(const string &strDomainsUri, uint64_t &digest)
+{
+    std::ifstream file(strDomainsUri, std::ios::binary);
+    string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    if (!file) {
+
+        warning() << "Unable to read " << strDomainsUri << ", settings cache disabled";
+        return false;
+    }
+    // Included files are not digested
+    if (content.find("http://www.w3.org/2001/XInclude") != string::npos) {
+
+        info() << "Configurable domains file includes other files, settings cache disabled";
+        return false;
+    }
+    // Settings are stored as raw blackboard bytes, only valid for the very same structure, which
+    // may come from any number of files: digest the loaded one
+    string structure;
+    describeStructure(getConstSystemClass(), structure);
+
+    std::list<string> criteria;
+    getConstSelectionCriteria()->listSelectionCriteria(criteria, true, false);
+
+    // Separate inputs so that content can not move from one to the other unnoticed
+    string inputs = getVersion() + '\0' + structure + '\0' + utility::asString(criteria) + '\0';
+    inputs += content;
+
+    digest = utility::digest(inputs.data(), inputs.size());
+
+    return true;
+}
+
+void CParameterMgr::describeStructure(const CElement *pElement, string &strDescription) const
+{
+    // Path and properties: kind, footprint and type attributes, such as ranges or value pairs
+    strDescription += pElement->getPath();
+    strDescription += '\0';
+    pElement->showProperties(strDescription);
+
+    size_t uiNbChildren = pElement->getNbChildren();
+
+    for (size_t uiChild = 0; uiChild < uiNbChildren; uiChild++) {
+
+        describeStructure(pElement->getChild(uiChild), strDescription);
+    }
+}
+
+bool CParameterMgr::loadSettingsCache(uint64_t digest)
+{
+    std::ifstream file(_settingsCacheLocation, std::ios::binary);
+    std::vector<uint8_t> content((std::istreambuf_iterator<char>(file)),
+                                 std::istreambuf_iterator<char>());
+
+    if (!file) {
+
+        info() << "No settings cache found in " << _settingsCacheLocation;
+        return false;
+    }
+    CBinaryStream binaryStream(std::move(content));
+
+    char magic[sizeof(settingsCacheMagic)];
+    uint32_t version;
+    uint64_t cachedDigest;
+
+    if (!binaryStream.read(magic, sizeof(magic)) ||
+        !std::equal(std::begin(magic), std::end(magic), settingsCacheMagic) ||
+        !binaryStream.readInteger(version) || version != settingsCacheVersion ||
+        !binaryStream.readInteger(cachedDigest) || cachedDigest != digest) {
+
+        info() << "Settings cache " << _settingsCacheLocation << " is stale";
+        return false;
+    }
+    string strError;
+
+    if (!getConfigurableDomains()->binaryDeserialize(
+            binaryStream, *getSystemClass(),
+            getConstSelectionCriteria()->getSelectionCriteriaDefinition(), strError) ||
+        !binaryStream.atEnd()) {
+
+        warning() << "Invalid settings cache " << _settingsCacheLocation << ": " << strError;
+        getConfigurableDomains()->clean();
+        return false;
+    }
+    info() << "Configurable domains loaded from settings cache " << _settingsCacheLocation;
+
+    return true;
+}
+
+void CParameterMgr::storeSettingsCache(uint64_t digest)
+{
+    CBinaryStream binaryStream;
+
+    binaryStream.write(settingsCacheMagic, sizeof(settingsCacheMagic));
+    binaryStream.writeInteger(settingsCacheVersion);
+    binaryStream.writeInteger(digest);
+    getConstConfigurableDomains()->binarySerialize(binaryStream);
+
+    // Write aside then rename, so that the cache is never seen partially written
+    string strTemporaryLocation = _settingsCacheLocation + ".tmp";
+    const std::vector<uint8_t> &content = binaryStream.getData();
+    {
+        std::ofstream file(strTemporaryLocation, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char *>(content.data()), content.size());
+
+        if (!file) {
+
+            warning() << "Unable to write settings cache " << strTemporaryLocation;
+            return;
+        }
+    }
+    if (std::rename(strTemporaryLocation.c_str(), _settingsCacheLocation.c_str()) != 0) {
+
+        warning() << "Unable to write settings cache " << _settingsCacheLocation;
+        std::remove(strTemporaryLocation.c_str());
+    }
 }
 
 // XML parsing
@@ -682,7 +852,7 @@ void CParameterMgr::applyConfigurations()
     LOG_CONTEXT("Configuration application request");
 
     // Lock state
-    lock_guard<mutex> autoLock(getBlackboardMutex());
+    CBlackboardWriteLock autoLock(*this);
 
     if (!_bTuningModeIsOn) {
 
@@ -697,6 +867,15 @@ void CParameterMgr::applyConfigurations()
 const CConfigurableElement *CParameterMgr::getConfigurableElement(const string &strPath,
                                                                   string &strError) const
 {
+    // Most paths are designated as indexed, fall back to navigation for the others
+    const CConfigurableElement *pIndexedElement =
+        getConstSystemClass()->findIndexedElement(strPath);
+
+    if (pIndexedElement != nullptr) {
+
+        return pIndexedElement;
+    }
+
     CPathNavigator pathNavigator(strPath);
 
     // Nagivate through system class
@@ -781,6 +960,44 @@ ElementHandle *CParameterMgr::createElementHandle(const std::string &path, std::
     return new ElementHandle(*pConfigurableElement, *this);
 }
 
+template <class T>
+TypedParameterHandle<T> *CParameterMgr::createTypedParameterHandle(const std::string &path,
+                                                                   std::string &error)
+{
+    CConfigurableElement *pConfigurableElement = getConfigurableElement(path, error);
+
+    if (!pConfigurableElement) {
+
+        // Element not found
+        error = "Element not found: " + path;
+        return nullptr;
+    }
+
+    if (!pConfigurableElement->isParameter()) {
+
+        // Element is not parameter
+        error = "Not a parameter: " + path;
+        return nullptr;
+    }
+    auto &parameter = static_cast<CBaseParameter &>(*pConfigurableElement);
+
+    if (parameter.getArrayLength() != 0) {
+
+        error = "Not a scalar parameter: " + path;
+        return nullptr;
+    }
+    return new TypedParameterHandle<T>(parameter, *this);
+}
+
+template TypedParameterHandle<bool> *CParameterMgr::createTypedParameterHandle(
+    const std::string &path, std::string &error);
+template TypedParameterHandle<uint32_t> *CParameterMgr::createTypedParameterHandle(
+    const std::string &path, std::string &error);
+template TypedParameterHandle<int32_t> *CParameterMgr::createTypedParameterHandle(
+    const std::string &path, std::string &error);
+template TypedParameterHandle<double> *CParameterMgr::createTypedParameterHandle(
+    const std::string &path, std::string &error);
+
 void CParameterMgr::getSettingsAsBytes(const CConfigurableElement &element,
                                        std::vector<uint8_t> &settings) const
 {
@@ -812,6 +1029,8 @@ bool CParameterMgr::setSettingsAsBytes(const CConfigurableElement &element,
     parameterAccessContext.setParameterBlackboard(_pMainParameterBlackboard);
     parameterAccessContext.setAutoSync(autoSyncOn());
 
+    CBlackboardWriteLock autoLock(*this);
+
     // Set the settings
     return element.setSettingsAsBytes(settings, parameterAccessContext);
 }
@@ -856,6 +1075,63 @@ bool CParameterMgr::getValidateSchemasOnStart() const
     return _bValidateSchemasOnStart;
 }
 
+void CParameterMgr::setParallelApply(bool bParallel)
+{
+    _bParallelApply = bParallel;
+}
+
+bool CParameterMgr::getParallelApply() const
+{
+    return _bParallelApply;
+}
+
+void CParameterMgr::setDecisionTable(bool bDecisionTable)
+{
+    _bDecisionTable = bDecisionTable;
+}
+
+bool CParameterMgr::getDecisionTable() const
+{
+    return _bDecisionTable;
+}
+
+void CParameterMgr::setSettingsDeduplication(bool bDeduplicate)
+{
+    _bSettingsDeduplication = bDeduplicate;
+}
+
+bool CParameterMgr::getSettingsDeduplication() const
+{
+    return _bSettingsDeduplication;
+}
+
+void CParameterMgr::setSettingsCacheLocation(const string &strLocation)
+{
+    _settingsCacheLocation = strLocation;
+}
+
+const string &CParameterMgr::getSettingsCacheLocation() const
+{
+    return _settingsCacheLocation;
+}
+
+void CParameterMgr::setAsynchronousSync(bool bAsynchronous)
+{
+    _bAsynchronousSync = bAsynchronous;
+}
+
+bool CParameterMgr::getAsynchronousSync() const
+{
+    return _bAsynchronousSync;
+}
+
+std::shared_future<core::Results> CParameterMgr::getSyncCompletion()
+{
+    lock_guard<mutex> autoLock(getBlackboardMutex());
+
+    return _syncCompletion;
+}
+
 /////////////////// Remote command parsers
 /// Version
 CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::versionCommandProcess(
@@ -914,6 +1190,12 @@ CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::statusCommandProces
     getConfigurableDomains()->listLastAppliedConfigurations(strLastAppliedConfigurations);
     strResult += strLastAppliedConfigurations;
 
+    /// Restored areas
+    utility::appendTitle(strResult, "Restored Areas:");
+    string strRestoreStatistics;
+    getConfigurableDomains()->listRestoreStatistics(strRestoreStatistics);
+    strResult += strRestoreStatistics;
+
     /// Criteria states
     utility::appendTitle(strResult, "Selection Criteria:");
     list<string> lstrSelectionCriteria;
@@ -1349,6 +1631,14 @@ CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::getRuleCommandProce
                : CCommandHandler::EFailed;
 }
 
+CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::showSettingsUsageCommandProcess(
+    const IRemoteCommand & /*command*/, string &strResult)
+{
+    getConfigurableDomains()->listSettingsUsage(strResult);
+
+    return CCommandHandler::ESucceeded;
+}
+
 /// Elements/Parameters
 CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::listElementsCommandProcess(
     const IRemoteCommand &remoteCommand, string &strResult)
@@ -1551,6 +1841,8 @@ bool CParameterMgr::setSettingsAsXML(CConfigurableElement *configurableElement,
     CConfigurationAccessContext configContext(error, _pMainParameterBlackboard, _bValueSpaceIsRaw,
                                               _bOutputRawFormatIsHex, false);
 
+    CBlackboardWriteLock autoLock(*this);
+
     CXmlParameterSerializingContext xmlParameterContext(configContext, error);
 
     // It doesn't make sense to resolve XIncludes on an imported file because
@@ -1567,7 +1859,9 @@ bool CParameterMgr::setSettingsAsXML(CConfigurableElement *configurableElement,
         CSyncerSet syncerSet;
         static_cast<CConfigurableElement *>(configurableElement)->fillSyncerSet(syncerSet);
         core::Results errors;
-        if (not syncerSet.sync(*_pMainParameterBlackboard, false, &errors)) {
+        bool success = syncerSet.sync(*_pMainParameterBlackboard, false, &errors);
+
+        if (not waitForSync(errors) or not success) {
             error = utility::asString(errors);
 
             return false;
@@ -2090,22 +2384,46 @@ bool CParameterMgr::accessValue(CParameterAccessContext &parameterAccessContext,
                                 const string &strPath, string &strValue, bool bSet,
                                 string &strError)
 {
-    // Lock state
-    lock_guard<mutex> autoLock(getBlackboardMutex());
-
     CPathNavigator pathNavigator(strPath);
 
-    // Nagivate through system class
-    if (!pathNavigator.navigateThrough(getConstSystemClass()->getName(), strError)) {
+    // Element to access, either indexed or found while navigating
+    const CConfigurableElement *pElement = getConstSystemClass()->findIndexedElement(strPath);
 
-        parameterAccessContext.setError(strError);
+    if (pElement != nullptr) {
 
-        return false;
+        pathNavigator.exhaust();
+    } else {
+
+        // Nagivate through system class
+        if (!pathNavigator.navigateThrough(getConstSystemClass()->getName(), strError)) {
+
+            parameterAccessContext.setError(strError);
+
+            return false;
+        }
+        pElement = getConstSystemClass();
+    }
+
+    if (!bSet && parameterAccessContext.getParameterBlackboard() == _pMainParameterBlackboard) {
+
+        // Lock-free get from a main blackboard snapshot, which is only read
+        std::shared_ptr<const CParameterBlackboard> snapshot = getParameterBlackboardSnapshot();
+        parameterAccessContext.setParameterBlackboard(
+            const_cast<CParameterBlackboard *>(snapshot.get()));
+
+        bool bSuccess =
+            pElement->accessValue(pathNavigator, strValue, bSet, parameterAccessContext);
+
+        parameterAccessContext.setParameterBlackboard(_pMainParameterBlackboard);
+
+        return bSuccess;
     }
 
-    // Do the get
-    return getConstSystemClass()->accessValue(pathNavigator, strValue, bSet,
-                                              parameterAccessContext);
+    // Lock state
+    CBlackboardWriteLock autoLock(*this);
+
+    // Do the access
+    return pElement->accessValue(pathNavigator, strValue, bSet, parameterAccessContext);
 }
 
 // Tuning mode
@@ -2123,7 +2441,7 @@ bool CParameterMgr::setTuningMode(bool bOn, string &strError)
         return false;
     }
     // Lock state
-    lock_guard<mutex> autoLock(getBlackboardMutex());
+    CBlackboardWriteLock autoLock(*this);
 
     // Warn domains about exiting tuning mode
     if (!bOn) {
@@ -2136,6 +2454,11 @@ bool CParameterMgr::setTuningMode(bool bOn, string &strError)
     // Store
     _bTuningModeIsOn = bOn;
 
+    if (bOn) {
+
+        ++_tuningSessionCount;
+    }
+
     return true;
 }
 
@@ -2210,7 +2533,9 @@ bool CParameterMgr::sync(string &strError)
 
     // Sync
     core::Results error;
-    if (!syncerSet.sync(*_pMainParameterBlackboard, false, &error)) {
+    bool bSuccess = syncerSet.sync(*_pMainParameterBlackboard, false, &error);
+
+    if (!waitForSync(error) || !bSuccess) {
 
         strError = utility::asString(error);
         return false;
@@ -2219,6 +2544,16 @@ bool CParameterMgr::sync(string &strError)
     return true;
 }
 
+bool CParameterMgr::waitForSync(core::Results &errors)
+{
+    core::Results syncErrors = getSystemClass()->getSyncCompletion().get();
+    bool bSuccess = syncErrors.empty();
+
+    errors.splice(errors.end(), syncErrors);
+
+    return bSuccess;
+}
+
 // Configuration/Domains handling
 bool CParameterMgr::createDomain(const string &strName, string &strError)
 {
@@ -2359,6 +2694,8 @@ bool CParameterMgr::restoreConfiguration(const string &strDomain, const string &
         return false;
     }
 
+    CBlackboardWriteLock autoLock(*this);
+
     // Delegate to configurable domains
     return logResult(
         getConstConfigurableDomains()->restoreConfiguration(
@@ -2412,6 +2749,8 @@ bool CParameterMgr::addConfigurableElementToDomain(const string &strDomain,
     CConfigurableElement *pConfigurableElement =
         static_cast<CConfigurableElement *>(pLocatedElement);
 
+    CBlackboardWriteLock autoLock(*this);
+
     // Delegate
     core::Results infos;
     bool isSuccess = getConfigurableDomains()->addConfigurableElementToDomain(
@@ -2557,6 +2896,11 @@ bool CParameterMgr::importDomainsXml(const string &xmlSource, bool withSettings,
 
         // Validate domains after XML import
         pConfigurableDomains->validate(_pMainParameterBlackboard);
+
+        if (_bSettingsDeduplication) {
+
+            pConfigurableDomains->shareSettings();
+        }
     }
 
     return importSuccess;
@@ -2620,6 +2964,16 @@ bool CParameterMgr::serializeElement(std::ostream &output,
         return false;
     }
 
+    // The domains are the biggest export by far, write them one domain at a time
+    const CConfigurableDomains *pConfigurableDomains = getConstConfigurableDomains();
+
+    if (&element == pConfigurableDomains) {
+
+        CXmlStreamWriter writer(output);
+
+        return pConfigurableDomains->toXml(writer, xmlSerializingContext);
+    }
+
     // Use a doc source by loading data from instantiated Configurable Domains
     CXmlMemoryDocSource memorySource(&element, _bValidateSchemasOnStart,
                                      element.getXmlElementName(), "parameter-framework",
@@ -2734,6 +3088,61 @@ CParameterBlackboard *CParameterMgr::getParameterBlackboard()
     return _pMainParameterBlackboard;
 }
 
+uint64_t CParameterMgr::getTuningSessionCount() const
+{
+    return _tuningSessionCount;
+}
+
+struct CParameterMgr::BlackboardSnapshot
+{
+    uint64_t version;
+    CParameterBlackboard blackboard;
+};
+
+CParameterMgr::CBlackboardWriteLock::CBlackboardWriteLock(CParameterMgr &parameterMgr)
+    : _parameterMgr(parameterMgr), _lock(parameterMgr.getBlackboardMutex())
+{
+}
+
+CParameterMgr::CBlackboardWriteLock::~CBlackboardWriteLock()
+{
+    // Let lock-free readers access the new values, mutex is released afterwards
+    _parameterMgr.publishParameterBlackboardSnapshot();
+}
+
+std::shared_ptr<const CParameterBlackboard> CParameterMgr::getParameterBlackboardSnapshot() const
+{
+    auto snapshot = std::atomic_load(&_blackboardSnapshot);
+
+    if (!snapshot) {
+
+        // Nothing published before start, the main blackboard has no concurrent writer yet
+        return std::shared_ptr<const CParameterBlackboard>(std::shared_ptr<void>(),
+                                                           _pMainParameterBlackboard);
+    }
+    // Share snapshot ownership
+    return std::shared_ptr<const CParameterBlackboard>(snapshot, &snapshot->blackboard);
+}
+
+void CParameterMgr::publishParameterBlackboardSnapshot()
+{
+    auto published = std::atomic_load(&_blackboardSnapshot);
+
+    if (published && published->version == _pMainParameterBlackboard->getVersion()) {
+
+        // Unchanged since last publication
+        return;
+    }
+    auto snapshot = std::make_shared<BlackboardSnapshot>();
+
+    snapshot->version = _pMainParameterBlackboard->getVersion();
+    snapshot->blackboard.setSize(_pMainParameterBlackboard->getSize());
+    snapshot->blackboard.restoreFrom(_pMainParameterBlackboard, 0);
+
+    std::atomic_store(&_blackboardSnapshot,
+                      std::shared_ptr<const BlackboardSnapshot>(std::move(snapshot)));
+}
+
 // Dynamic creation library feeding
 void CParameterMgr::feedElementLibraries()
 {
@@ -2830,7 +3239,7 @@ CParameterMgr::CommandHandler CParameterMgr::createCommandHandler()
         commandHandler->addCommandParser(
             remoteCommandParserItem._pcCommandName, remoteCommandParserItem._pfnParser,
             remoteCommandParserItem._minArgumentCount, remoteCommandParserItem._pcHelp,
-            remoteCommandParserItem._pcDescription);
+            remoteCommandParserItem._pcDescription, remoteCommandParserItem._bReadOnly);
     }
 
     return commandHandler;
@@ -2852,11 +3261,20 @@ bool CParameterMgr::handleRemoteProcessingInterface(string &strError)
         return true;
     }
 
-    auto port = getConstFrameworkConfiguration()->getServerPort();
+    const CParameterFrameworkConfiguration *pConfiguration = getConstFrameworkConfiguration();
+    const string &strSocketPath = pConfiguration->getServerSocketPath();
+    auto port = pConfiguration->getServerPort();
+
+    // Where the server listens, for logging
+    string strAddress = strSocketPath.empty() ? "port " + std::to_string(port)
+                                              : "socket " + strSocketPath;
 
     try {
         // The ownership of remoteComandHandler is given to Bg remote processor server.
-        _pRemoteProcessorServer = new BackgroundRemoteProcessorServer(port, createCommandHandler());
+        _pRemoteProcessorServer =
+            strSocketPath.empty()
+                ? new BackgroundRemoteProcessorServer(port, createCommandHandler())
+                : new BackgroundRemoteProcessorServer(strSocketPath, createCommandHandler());
     } catch (std::runtime_error &e) {
         strError = string("ParameterMgr: Unable to create Remote Processor Server: ") + e.what();
         return false;
@@ -2868,12 +3286,11 @@ bool CParameterMgr::handleRemoteProcessingInterface(string &strError)
     }
 
     if (!_pRemoteProcessorServer->start(strError)) {
-        ostringstream oss;
-        oss << "ParameterMgr: Unable to start remote processor server on port " << port;
-        strError = oss.str() + ": " + strError;
+        strError = "ParameterMgr: Unable to start remote processor server on " + strAddress + ": " +
+                   strError;
         return false;
     }
-    info() << "Remote Processor Server started on port " << port;
+    info() << "Remote Processor Server started on " << strAddress;
     return true;
 }
 
@@ -2933,15 +3350,20 @@ void CParameterMgr::doApplyConfigurations(bool bForce)
 
     core::Results infos;
     // Check subsystems that need resync
-    getSystemClass()->checkForSubsystemsToResync(syncerSet, infos);
+    getSystemClass()->checkForSubsystemsToResync(syncerSet, *_pMainParameterBlackboard, infos);
 
     // Ensure application of currently selected configurations
-    getConfigurableDomains()->apply(_pMainParameterBlackboard, syncerSet, bForce, infos);
+    // Skip formatting application infos nobody will read
+    getConfigurableDomains()->apply(_pMainParameterBlackboard, syncerSet, bForce, _bParallelApply,
+                                    _bDecisionTable, _logger.isInfoEnabled() ? &infos : nullptr);
     info() << infos;
 
     // Reset the modified status of the current criteria to indicate that a new configuration has
     // been applied
     getSelectionCriteria()->resetModifiedStatus();
+
+    // Synchronizations may still be running on subsystem threads
+    _syncCompletion = getSystemClass()->getSyncCompletion();
 }
 
 // Export to XML string
@@ -29,6 +29,8 @@
  */
 #pragma once
 
+#include <atomic>
+#include <future>
 #include <mutex>
 #include <map>
 #include <vector>
@@ -42,6 +44,8 @@
 #include "XmlDomainExportContext.h"
 #include "Results.h"
 #include "ElementHandle.h"
+#include "TypedParameterHandle.h"
+#include "ParameterTransaction.h"
 #include <log/LogWrapper.h>
 #include <log/Context.h>
 
@@ -81,6 +85,9 @@ class CParameterMgr : private CElement
 
     // Parameter handle friendship
     friend class ElementHandle;
+    template <class T>
+    friend class TypedParameterHandle;
+    friend class ParameterTransaction;
 
 public:
     // Construction
@@ -144,6 +151,22 @@ public:
      */
     ElementHandle *createElementHandle(const std::string &path, std::string &error);
 
+    /** Creates a typed handle to a scalar parameter.
+     *
+     * The returned object is owned by the client who is responsible to delete it.
+     *
+     * @tparam T the type the parameter is accessed as, one of bool, uint32_t, int32_t, double
+     * @param[in] path A string representing a path to a scalar parameter.
+     * @param[out] error On error: an human readable error message
+     *                   On success: undefined
+     *
+     * @return A typed parameter handle on success
+     *         nullptr on error
+     */
+    template <class T>
+    TypedParameterHandle<T> *createTypedParameterHandle(const std::string &path,
+                                                        std::string &error);
+
     /** Is the remote interface forcefully disabled ?
      */
     bool getForceNoRemoteInterface() const;
@@ -210,6 +233,82 @@ public:
      */
     bool getValidateSchemasOnStart() const;
 
+    /** Should domains of distinct subsystems be applied concurrently?
+     *
+     * @param[in] bParallel:
+     *     If set to true, domains not sharing any subsystem are applied by distinct threads
+     *     If set to false, domains are applied one after the other (default behaviour)
+     */
+    void setParallelApply(bool bParallel);
+
+    /** Would domains of distinct subsystems be applied concurrently?
+     *
+     * @return parallel application policy state.
+     */
+    bool getParallelApply() const;
+
+    /** Should domains memorize their applicable configuration per criterion states?
+     *
+     * @param[in] bDecisionTable:
+     *     If set to true, each domain memorizes the configuration found applicable for the
+     *         states of the criteria it depends on, and skips rule evaluation next time
+     *     If set to false, rules are evaluated on each application (default behaviour)
+     */
+    void setDecisionTable(bool bDecisionTable);
+
+    /** Would domains memorize their applicable configuration per criterion states?
+     *
+     * @return decision table policy state.
+     */
+    bool getDecisionTable() const;
+
+    /** Should identical configuration settings share their storage?
+     *
+     * @param[in] bDeduplicate:
+     *     If set to true, identical area settings of all configurations are stored once after
+     *     loading or importing domains, and copied back on modification
+     *     If set to false, each configuration holds its own settings (default behaviour)
+     */
+    void setSettingsDeduplication(bool bDeduplicate);
+
+    /** Would identical configuration settings share their storage?
+     *
+     * @return settings deduplication policy state.
+     */
+    bool getSettingsDeduplication() const;
+
+    /** Where should loaded settings be cached in binary format?
+     *
+     * @param[in] strLocation path of the cache file, empty to disable caching (default)
+     */
+    void setSettingsCacheLocation(const std::string &strLocation);
+
+    /** @return the settings cache file path, empty if caching is disabled */
+    const std::string &getSettingsCacheLocation() const;
+
+    /** Should subsystems be synchronized to hardware from their own thread?
+     *
+     * @param[in] bAsynchronous:
+     *     If set to true, each subsystem synchronizes from a worker thread the snapshots of
+     *     settings posted when applying configurations, which returns once they are posted
+     *     If set to false, configuration application synchronizes subsystems before returning
+     *     (default behaviour)
+     */
+    void setAsynchronousSync(bool bAsynchronous);
+
+    /** Would subsystems be synchronized to hardware from their own thread?
+     *
+     * @return asynchronous synchronization policy state.
+     */
+    bool getAsynchronousSync() const;
+
+    /** Get the completion of the synchronizations of the last configuration application
+     *
+     * @return a future made ready once all subsystems have synchronized the configurations
+     *         applied so far, holding the synchronization errors. Invalid before start.
+     */
+    std::shared_future<core::Results> getSyncCompletion();
+
     //////////// Tuning /////////////
     /**
      * Activate / deactivate the tuning mode.
@@ -416,6 +515,9 @@ private:
         size_t _minArgumentCount;
         const char *_pcHelp;
         const char *_pcDescription;
+        /** Command leaving the parameter manager untouched, which may run concurrently with
+         * other such commands */
+        bool _bReadOnly;
     };
 
     ////////////////:: Remote command parsers
@@ -498,6 +600,8 @@ private:
                                                            std::string &strResult);
     CCommandHandler::CommandStatus getRuleCommandProcess(const IRemoteCommand &remoteCommand,
                                                          std::string &strResult);
+    CCommandHandler::CommandStatus showSettingsUsageCommandProcess(
+        const IRemoteCommand &remoteCommand, std::string &strResult);
     /// Elements/Parameters
     CCommandHandler::CommandStatus listElementsCommandProcess(const IRemoteCommand &remoteCommand,
                                                               std::string &strResult);
@@ -635,6 +739,37 @@ private:
     // Blackboard reference (dynamic parameter handling)
     CParameterBlackboard *getParameterBlackboard();
 
+    /** @return the number of tuning sessions started so far, domains only change during those */
+    uint64_t getTuningSessionCount() const;
+
+    /** Blackboard mutex lock for main blackboard writers
+     *
+     * Publishes a snapshot of the main blackboard before releasing the mutex, if the main
+     * blackboard has been modified while locked.
+     */
+    class CBlackboardWriteLock
+    {
+    public:
+        CBlackboardWriteLock(CParameterMgr &parameterMgr);
+        ~CBlackboardWriteLock();
+
+    private:
+        CParameterMgr &_parameterMgr;
+        std::lock_guard<std::mutex> _lock;
+    };
+
+    /** Get a snapshot of the main blackboard for lock-free reading
+     *
+     * Snapshots are published by main blackboard writers, see CBlackboardWriteLock, so readers
+     * never lock nor copy.
+     *
+     * @return an immutable copy of the main blackboard
+     */
+    std::shared_ptr<const CParameterBlackboard> getParameterBlackboardSnapshot() const;
+
+    // Publish a snapshot of the main blackboard if outdated, blackboard mutex must be held
+    void publishParameterBlackboardSnapshot();
+
     // Parameter access
     bool accessValue(CParameterAccessContext &parameterAccessContext, const std::string &strPath,
                      std::string &strValue, bool bSet, std::string &strError);
@@ -660,6 +795,37 @@ private:
     bool loadSettings(std::string &strError);
     bool loadSettingsFromConfigFile(std::string &strError);
 
+    /** Digest everything the loaded settings depend on to key the settings cache
+     *
+     * That is the framework version, the loaded structure (whatever the files it comes from),
+     * the selection criteria definitions and the configurable domains file.
+     *
+     * @param[in] strDomainsUri the configurable domains file
+     * @param[out] digest the settings inputs digest
+     * @return false if the file can not be read or includes other files, true otherwise
+     */
+    bool digestSettingsInputs(const std::string &strDomainsUri, uint64_t &digest);
+
+    /** Describe an element structure for digesting, without going through XML
+     *
+     * @param[in] pElement the root of the structure to describe
+     * @param[in,out] strDescription the string the description is appended to
+     */
+    void describeStructure(const CElement *pElement, std::string &strDescription) const;
+
+    /** Load configurable domains from the settings cache
+     *
+     * @param[in] digest the expected settings inputs digest
+     * @return false if the cache is missing, stale or invalid, true otherwise
+     */
+    bool loadSettingsCache(uint64_t digest);
+
+    /** Store configurable domains to the settings cache
+     *
+     * @param[in] digest the configurable domains file digest
+     */
+    void storeSettingsCache(uint64_t digest);
+
     /** Get settings from a configurable element in binary format.
      *
      * @param[in] element configurable element.
@@ -822,6 +988,13 @@ private:
     // Apply configurations
     void doApplyConfigurations(bool bForce);
 
+    /** Wait for the synchronizations posted to subsystem threads, if any, to complete
+     *
+     * @param[out] errors the synchronization errors, appended
+     * @return true if all synchronizations succeeded, false otherwise
+     */
+    bool waitForSync(core::Results &errors);
+
     // Dynamic object creation libraries feeding
     void feedElementLibraries();
 
@@ -846,6 +1019,9 @@ private:
     // Tuning
     bool _bTuningModeIsOn{false};
 
+    /** Number of tuning sessions started so far, see getTuningSessionCount() */
+    std::atomic<uint64_t> _tuningSessionCount{0};
+
     // Value Space
     bool _bValueSpaceIsRaw{false};
 
@@ -880,6 +1056,12 @@ private:
     // Blackboard access mutex
     std::mutex _blackboardMutex;
 
+    // Main blackboard copy along with the main blackboard version it was taken at
+    struct BlackboardSnapshot;
+
+    /** Last published main blackboard snapshot, accessed atomically */
+    std::shared_ptr<const BlackboardSnapshot> _blackboardSnapshot;
+
     /** Application main logger based on the one provided by the client */
     mutable core::log::Logger _logger;
 
@@ -905,4 +1087,34 @@ private:
      * If set to false, no .xml/xsd validation will happen (default behaviour)
      */
     bool _bValidateSchemasOnStart{false};
+
+    /** If set to true, domains not sharing any subsystem are applied concurrently.
+     * If set to false, domains are applied one after the other (default behaviour).
+     */
+    bool _bParallelApply{false};
+
+    /** If set to true, domains memorize their applicable configuration per criterion states.
+     * If set to false, rules are evaluated on each application (default behaviour).
+     */
+    bool _bDecisionTable{false};
+
+    /** If set to true, identical configuration settings share their storage.
+     * If set to false, each configuration holds its own settings (default behaviour).
+     */
+    bool _bSettingsDeduplication{false};
+
+    /** If set to true, subsystems are synchronized from their own thread.
+     * If set to false, subsystems are synchronized by the caller (default behaviour).
+     */
+    bool _bAsynchronousSync{false};
+
+    /** Completion of the synchronizations of the last configuration application */
+    std::shared_future<core::Results> _syncCompletion;
+
+    /** Binary settings cache file, caching disabled if empty */
+    std::string _settingsCacheLocation;
+
+    /** Binary settings cache format identification */
+    static const char settingsCacheMagic[4];
+    static const uint32_t settingsCacheVersion = 1;
 };
@@ -33,6 +33,7 @@
 
 #include "CommandHandlerWrapper.h"
 
+#include <cassert>
 #include <list>
 
 using std::string;
@@ -47,6 +48,13 @@ CommandHandlerInterface *CParameterMgrFullConnector::createCommandHandler()
     return new CommandHandlerWrapper(_pParameterMgr->createCommandHandler());
 }
 
+ParameterTransaction CParameterMgrFullConnector::createTransaction()
+{
+    assert(_bStarted);
+
+    return ParameterTransaction(*_pParameterMgr);
+}
+
 void CParameterMgrFullConnector::setFailureOnMissingSubsystem(bool bFail)
 {
     std::string error;
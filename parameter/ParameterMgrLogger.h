@@ -47,6 +47,10 @@ public:
 
     void warning(const std::string &log) override { _parameterMgrConnector.warning(log); }
 
+    bool isInfoEnabled() const override { return _parameterMgrConnector.isInfoEnabled(); }
+
+    bool isWarningEnabled() const override { return _parameterMgrConnector.isWarningEnabled(); }
+
 private:
     // Log destination
     T &_parameterMgrConnector;
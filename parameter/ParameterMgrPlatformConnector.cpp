@@ -97,6 +97,24 @@ ElementHandle *CParameterMgrPlatformConnector::createElementHandle(const string
     return _pParameterMgr->createElementHandle(strPath, strError);
 }
 
+template <class T>
+TypedParameterHandle<T> *CParameterMgrPlatformConnector::createTypedParameterHandle(
+    const string &strPath, string &strError) const
+{
+    assert(_bStarted);
+
+    return _pParameterMgr->createTypedParameterHandle<T>(strPath, strError);
+}
+
+template TypedParameterHandle<bool> *
+CParameterMgrPlatformConnector::createTypedParameterHandle(const string &, string &) const;
+template TypedParameterHandle<uint32_t> *
+CParameterMgrPlatformConnector::createTypedParameterHandle(const string &, string &) const;
+template TypedParameterHandle<int32_t> *
+CParameterMgrPlatformConnector::createTypedParameterHandle(const string &, string &) const;
+template TypedParameterHandle<double> *
+CParameterMgrPlatformConnector::createTypedParameterHandle(const string &, string &) const;
+
 // Logging
 void CParameterMgrPlatformConnector::setLogger(CParameterMgrPlatformConnector::ILogger *pLogger)
 {
@@ -176,6 +194,104 @@ bool CParameterMgrPlatformConnector::getValidateSchemasOnStart() const
     return _pParameterMgr->getValidateSchemasOnStart();
 }
 
+bool CParameterMgrPlatformConnector::setParallelApply(bool bParallel, std::string &strError)
+{
+    if (_bStarted) {
+
+        strError = "Can not set parallel apply policy while running";
+        return false;
+    }
+
+    _pParameterMgr->setParallelApply(bParallel);
+    return true;
+}
+
+bool CParameterMgrPlatformConnector::getParallelApply() const
+{
+    return _pParameterMgr->getParallelApply();
+}
+
+bool CParameterMgrPlatformConnector::setDecisionTable(bool bDecisionTable, std::string &strError)
+{
+    if (_bStarted) {
+
+        strError = "Can not set decision table policy while running";
+        return false;
+    }
+
+    _pParameterMgr->setDecisionTable(bDecisionTable);
+    return true;
+}
+
+bool CParameterMgrPlatformConnector::getDecisionTable() const
+{
+    return _pParameterMgr->getDecisionTable();
+}
+
+bool CParameterMgrPlatformConnector::setSettingsDeduplication(bool bDeduplicate,
+                                                              std::string &strError)
+{
+    if (_bStarted) {
+
+        strError = "Can not set settings deduplication policy while running";
+        return false;
+    }
+
+    _pParameterMgr->setSettingsDeduplication(bDeduplicate);
+    return true;
+}
+
+bool CParameterMgrPlatformConnector::getSettingsDeduplication() const
+{
+    return _pParameterMgr->getSettingsDeduplication();
+}
+
+bool CParameterMgrPlatformConnector::setSettingsCacheLocation(const std::string &strLocation,
+                                                              std::string &strError)
+{
+    if (_bStarted) {
+
+        strError = "Can not set settings cache location while running";
+        return false;
+    }
+
+    _pParameterMgr->setSettingsCacheLocation(strLocation);
+    return true;
+}
+
+std::string CParameterMgrPlatformConnector::getSettingsCacheLocation() const
+{
+    return _pParameterMgr->getSettingsCacheLocation();
+}
+
+bool CParameterMgrPlatformConnector::setAsynchronousSync(bool bAsynchronous,
+                                                         std::string &strError)
+{
+    if (_bStarted) {
+
+        strError = "Can not set asynchronous synchronization policy while running";
+        return false;
+    }
+
+    _pParameterMgr->setAsynchronousSync(bAsynchronous);
+    return true;
+}
+
+bool CParameterMgrPlatformConnector::getAsynchronousSync() const
+{
+    return _pParameterMgr->getAsynchronousSync();
+}
+
+std::shared_future<std::list<std::string>> CParameterMgrPlatformConnector::getSyncCompletion()
+    const
+{
+    if (!_bStarted) {
+
+        return {};
+    }
+    return _pParameterMgr->getSyncCompletion();
+}
+
 // Start
 bool CParameterMgrPlatformConnector::start(string &strError)
 {
@@ -212,3 +328,14 @@ void CParameterMgrPlatformConnector::warning(const string &log)
         _pLogger->warning(log);
     }
 }
+
+bool CParameterMgrPlatformConnector::isInfoEnabled() const
+{
+    // Without client logger, logs are discarded anyway
+    return _pLogger != nullptr && _pLogger->isInfoEnabled();
+}
+
+bool CParameterMgrPlatformConnector::isWarningEnabled() const
+{
+    return _pLogger != nullptr && _pLogger->isWarningEnabled();
+}
@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "ParameterTransaction.h"
+#include "ParameterMgr.h"
+#include "BaseParameter.h"
+#include "ParameterAccessContext.h"
+#include "ParameterBlackboard.h"
+#include "SyncerSet.h"
+#include "Utility.h"
+
+#include <mutex>
+
+using std::string;
+using std::mutex;
+using std::lock_guard;
+
+/** @return 0 by default, ie for non overloaded types. */
+template <class T>
+static size_t getUserInputSize(const T & /*scalar*/)
+{
+    return 0;
+}
+
+/** @return the vector's size. */
+template <class T>
+static size_t getUserInputSize(const std::vector<T> &vector)
+{
+    return vector.size();
+}
+
+ParameterTransaction::ParameterTransaction(CParameterMgr &parameterMgr)
+    : mParameterMgr(parameterMgr)
+{
+}
+
+template <class T>
+bool ParameterTransaction::stage(const ElementHandle &handle, const T &value, string &error)
+{
+    if (not handle.checkSetValidity(getUserInputSize(value), error)) {
+        return false;
+    }
+    // Safe downcast thanks to isParameter check in checkSetValidity
+    auto &parameter = static_cast<const CBaseParameter &>(handle.mElement);
+
+    return stageWrite(handle,
+                      [&parameter, value](CParameterAccessContext &parameterAccessContext) {
+                          // BaseParameter::access takes a non-const argument
+                          T copy = value;
+                          return parameter.access(copy, true, parameterAccessContext);
+                      },
+                      error);
+}
+
+bool ParameterTransaction::stageWrite(const ElementHandle &handle,
+                                      std::function<bool(CParameterAccessContext &)> write,
+                                      string &error)
+{
+    if (&handle.mParameterMgr != &mParameterMgr) {
+
+        error = "Element " + handle.getPath() + " belongs to another parameter framework";
+        return false;
+    }
+    if (mWrites.empty()) {
+
+        mTuningSession = mParameterMgr.getTuningSessionCount();
+    }
+    mWrites.push_back({&handle.mElement, std::move(write)});
+
+    return true;
+}
+
+bool ParameterTransaction::setAsBoolean(const ElementHandle &handle, bool value, string &error)
+{
+    return stage(handle, value, error);
+}
+
+bool ParameterTransaction::setAsBooleanArray(const ElementHandle &handle,
+                                             const std::vector<bool> &value, string &error)
+{
+    return stage(handle, value, error);
+}
+
+bool ParameterTransaction::setAsInteger(const ElementHandle &handle, uint32_t value,
+                                        string &error)
+{
+    return stage(handle, value, error);
+}
+
+bool ParameterTransaction::setAsIntegerArray(const ElementHandle &handle,
+                                             const std::vector<uint32_t> &value, string &error)
+{
+    return stage(handle, value, error);
+}
+
+bool ParameterTransaction::setAsSignedInteger(const ElementHandle &handle, int32_t value,
+                                              string &error)
+{
+    return stage(handle, value, error);
+}
+
+bool ParameterTransaction::setAsSignedIntegerArray(const ElementHandle &handle,
+                                                   const std::vector<int32_t> &value,
+                                                   string &error)
+{
+    return stage(handle, value, error);
+}
+
+bool ParameterTransaction::setAsDouble(const ElementHandle &handle, double value, string &error)
+{
+    return stage(handle, value, error);
+}
+
+bool ParameterTransaction::setAsDoubleArray(const ElementHandle &handle,
+                                            const std::vector<double> &value, string &error)
+{
+    return stage(handle, value, error);
+}
+
+bool ParameterTransaction::setAsString(const ElementHandle &handle, const string &value,
+                                       string &error)
+{
+    return stage(handle, value, error);
+}
+
+bool ParameterTransaction::setAsStringArray(const ElementHandle &handle,
+                                            const std::vector<string> &value, string &error)
+{
+    return stage(handle, value, error);
+}
+
+bool ParameterTransaction::setAsBytes(const ElementHandle &handle,
+                                      const std::vector<uint8_t> &value, string &error)
+{
+    if (!handle.isRogue()) {
+
+        error = "Can not set element \"" + handle.getPath() + "\" as it is not rogue.";
+        return false;
+    }
+    if (value.size() != handle.getSize()) {
+
+        error = "Wrong size: Expected: " + std::to_string(handle.getSize()) +
+                " Provided: " + std::to_string(value.size());
+        return false;
+    }
+    const CConfigurableElement &element = handle.mElement;
+
+    return stageWrite(handle,
+                      [&element, value](CParameterAccessContext &parameterAccessContext) {
+                          return element.setSettingsAsBytes(value, parameterAccessContext);
+                      },
+                      error);
+}
+
+bool ParameterTransaction::commit(string &error)
+{
+    // Staged writes are consumed whatever the outcome
+    std::vector<Write> writes;
+    writes.swap(mWrites);
+
+    // Ensure we're safe against blackboard foreign access
+    CParameterMgr::CBlackboardWriteLock autoLock(mParameterMgr);
+
+    // When in tuning mode, silently skip "set" requests
+    if (mParameterMgr.tuningModeOn()) {
+
+        return true;
+    }
+    // Elements may have been added to domains since staged
+    if (mTuningSession != mParameterMgr.getTuningSessionCount()) {
+
+        for (const Write &write : writes) {
+
+            if (!write.element->isRogue()) {
+
+                error = "Can not set element \"" + write.element->getPath() +
+                        "\" as it is not rogue.";
+                return false;
+            }
+        }
+    }
+    CParameterBlackboard &blackboard = *mParameterMgr.getParameterBlackboard();
+
+    // Keep previous values for rollback
+    std::vector<std::vector<uint8_t>> previousValues;
+    previousValues.reserve(writes.size());
+
+    for (const Write &write : writes) {
+
+        std::vector<uint8_t> previousValue(write.element->getFootPrint());
+        blackboard.readBuffer(previousValue.data(), previousValue.size(),
+                              write.element->getOffset());
+        previousValues.push_back(std::move(previousValue));
+    }
+    auto rollback = [&] {
+        // Reverse order, in case of several writes of the same element
+        for (size_t index = writes.size(); index-- != 0;) {
+
+            blackboard.writeBuffer(previousValues[index].data(), previousValues[index].size(),
+                                   writes[index].element->getOffset());
+        }
+    };
+
+    // Write without synchronizing, elements are synchronized all together afterwards
+    CParameterAccessContext parameterAccessContext(error, &blackboard);
+    parameterAccessContext.setAutoSync(false);
+
+    CSyncerSet syncerSet;
+
+    for (const Write &write : writes) {
+
+        if (!write.apply(parameterAccessContext)) {
+
+            rollback();
+            return false;
+        }
+        write.element->fillSyncerSet(syncerSet);
+    }
+    if (mParameterMgr.autoSyncOn()) {
+
+        core::Results errors;
+
+        if (!syncerSet.sync(blackboard, false, &errors)) {
+
+            error = utility::asString(errors);
+
+            // Bring the hardware back to previous values as well
+            rollback();
+            syncerSet.sync(blackboard, false, nullptr);
+            return false;
+        }
+    }
+    return true;
+}
+
+void ParameterTransaction::discard()
+{
+    mWrites.clear();
+}
+
+size_t ParameterTransaction::getStagedWriteCount() const
+{
+    return mWrites.size();
+}
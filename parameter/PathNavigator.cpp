@@ -90,6 +90,11 @@ std::string *CPathNavigator::next()
     return nullptr;
 }
 
+void CPathNavigator::exhaust()
+{
+    _currentIndex = _astrItems.size();
+}
+
 std::string CPathNavigator::getCurrentPath() const
 {
     std::string strPath = "/";
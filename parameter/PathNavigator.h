@@ -47,6 +47,9 @@ public:
     // Nagivate
     std::string *next();
 
+    /** Navigate past the last item, e.g. once the designated element has been found by path */
+    void exhaust();
+
     // Current path
     std::string getCurrentPath() const;
 
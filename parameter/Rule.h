@@ -30,10 +30,13 @@
 #pragma once
 
 #include "Element.h"
+#include "RuleProgram.h"
 
+#include <set>
 #include <string>
 
 class CRuleParser;
+class CSelectionCriterion;
 
 class CRule : public CElement
 {
@@ -47,4 +50,16 @@ public:
 
     // Rule check
     virtual bool matches() const = 0;
+
+    // Gather selection criteria the rule depends on
+    virtual void gatherCriteria(std::set<const CSelectionCriterion *> &criteria) const = 0;
+
+    /** Compile the rule into a rule program
+     *
+     * @param[in,out] program the program to add rule instructions to
+     * @param[in] onMatch where the program shall jump to if the rule matches
+     * @param[in] onMismatch where the program shall jump to if the rule does not match
+     */
+    virtual void compile(CRuleProgram &program, CRuleProgram::Label onMatch,
+                         CRuleProgram::Label onMismatch) const = 0;
 };
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "RuleProgram.h"
+#include "Rule.h"
+#include <cassert>
+
+void CRuleProgram::compile(const CRule &rule)
+{
+    clear();
+
+    // Match and mismatch labels, placed by link
+    _labelPositions.assign(2, 0);
+
+    rule.compile(*this, matchLabel, mismatchLabel);
+
+    link();
+}
+
+void CRuleProgram::clear()
+{
+    _instructions.clear();
+    _labelPositions.clear();
+    _criterionStates = nullptr;
+}
+
+bool CRuleProgram::empty() const
+{
+    return _instructions.empty();
+}
+
+CRuleProgram::Label CRuleProgram::createLabel()
+{
+    _labelPositions.push_back(0);
+
+    return static_cast<Label>(_labelPositions.size() - 1);
+}
+
+void CRuleProgram::placeLabel(Label label)
+{
+    assert(label < _labelPositions.size());
+
+    _labelPositions[label] = static_cast<uint32_t>(_instructions.size());
+}
+
+void CRuleProgram::addTest(Opcode opcode, const std::vector<int> &criterionStates,
+                           size_t criterionIndex, int value, Label onMatch, Label onMismatch)
+{
+    // All criteria share the same state array
+    assert(!_criterionStates || _criterionStates == &criterionStates);
+    _criterionStates = &criterionStates;
+
+    _instructions.push_back(
+        {opcode, static_cast<uint32_t>(criterionIndex), value, onMatch, onMismatch});
+}
+
+void CRuleProgram::addJump(Label target)
+{
+    _instructions.push_back({EAlways, 0, 0, target, target});
+}
+
+void CRuleProgram::link()
+{
+    // Past the end positions stop the evaluation with the according result
+    auto size = static_cast<uint32_t>(_instructions.size());
+    _labelPositions[matchLabel] = size;
+    _labelPositions[mismatchLabel] = size + 1;
+
+    for (auto &instruction : _instructions) {
+
+        instruction.onMatch = _labelPositions[instruction.onMatch];
+        instruction.onMismatch = _labelPositions[instruction.onMismatch];
+    }
+    _labelPositions.clear();
+}
+
+bool CRuleProgram::matches() const
+{
+    auto size = static_cast<uint32_t>(_instructions.size());
+    uint32_t pc = 0;
+
+    while (pc < size) {
+
+        const Instruction &instruction = _instructions[pc];
+        bool bMatches = true;
+
+        if (instruction.opcode != EAlways) {
+
+            int state = (*_criterionStates)[instruction.criterionIndex];
+
+            switch (instruction.opcode) {
+            case EIs:
+                bMatches = state == instruction.value;
+                break;
+            case EIsNot:
+                bMatches = state != instruction.value;
+                break;
+            case EIncludes:
+                bMatches = (state & instruction.value) == instruction.value;
+                break;
+            case EExcludes:
+                bMatches = (state & instruction.value) == 0;
+                break;
+            default:
+                assert(0);
+                break;
+            }
+        }
+        pc = bMatches ? instruction.onMatch : instruction.onMismatch;
+    }
+    return pc == size;
+}
+
+bool CRuleProgram::matches(const CRule &rule) const
+{
+    return empty() ? rule.matches() : matches();
+}
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class CRule;
+
+/** Flat, compiled form of an application rule tree.
+ *
+ * A rule tree (CCompoundRule and CSelectionCriterionRule elements) is compiled into a contiguous
+ * array of instructions, each one testing a criterion state and jumping to the next instruction
+ * to evaluate depending on the test result. Compound rules are thus short-circuited through jump
+ * targets instead of recursion.
+ *
+ * Evaluation reads criterion states directly from the dense criterion state array (see
+ * CSelectionCriterion::getStates), avoiding virtual dispatch and pointer chasing.
+ */
+class CRuleProgram
+{
+public:
+    /** Instruction test kind */
+    enum Opcode : uint8_t
+    {
+        EIs,
+        EIsNot,
+        EIncludes,
+        EExcludes,
+        EAlways
+    };
+
+    /** Symbolic jump target, resolved to an instruction index once compilation is done */
+    using Label = uint32_t;
+
+    /** Label to jump to when the rule matches */
+    static const Label matchLabel = 0;
+    /** Label to jump to when the rule does not match */
+    static const Label mismatchLabel = 1;
+
+    /** Compile a rule tree, replacing any previously compiled one
+     *
+     * @param[in] rule the root of the rule tree
+     */
+    void compile(const CRule &rule);
+
+    /** Forget the compiled rule */
+    void clear();
+
+    /** @return true if no rule has been compiled */
+    bool empty() const;
+
+    /** Evaluate the compiled rule against current criterion states
+     *
+     * @return true if the rule matches
+     */
+    bool matches() const;
+
+    /** Evaluate a rule, through its compiled form if any
+     *
+     * Falls back to the evaluation of the rule tree itself if no rule has been compiled yet.
+     *
+     * @param[in] rule the root of the rule tree this program has been compiled from, if any
+     * @return true if the rule matches
+     */
+    bool matches(const CRule &rule) const;
+
+    /** @name Compilation interface, for use by CRule::compile
+     * @{ */
+    /** @return a new label, to be placed later on */
+    Label createLabel();
+
+    /** Place a label on the next instruction to be added */
+    void placeLabel(Label label);
+
+    /** Add a test instruction
+     *
+     * @param[in] opcode the test to perform
+     * @param[in] criterionStates dense array of criterion states
+     * @param[in] criterionIndex index of the tested criterion in criterionStates
+     * @param[in] value the value (or mask, for inclusive criteria) to test against
+     * @param[in] onMatch where to jump if the test succeeds
+     * @param[in] onMismatch where to jump if the test fails
+     */
+    void addTest(Opcode opcode, const std::vector<int> &criterionStates, size_t criterionIndex,
+                 int value, Label onMatch, Label onMismatch);
+
+    /** Add an unconditional jump */
+    void addJump(Label target);
+    /** @} */
+
+private:
+    struct Instruction
+    {
+        Opcode opcode;
+        uint32_t criterionIndex;
+        int32_t value;
+        /** Next instruction index if test succeeds (label while compiling) */
+        uint32_t onMatch;
+        /** Next instruction index if test fails (label while compiling) */
+        uint32_t onMismatch;
+    };
+
+    /** Replace labels by instruction indexes */
+    void link();
+
+    std::vector<Instruction> _instructions;
+
+    /** Instruction index of each label, only relevant while compiling */
+    std::vector<uint32_t> _labelPositions;
+
+    /** Criterion states tested by the instructions */
+    const std::vector<int> *_criterionStates{nullptr};
+};
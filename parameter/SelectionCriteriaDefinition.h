@@ -32,6 +32,7 @@
 #include "Element.h"
 #include "SelectionCriterion.h"
 #include <log/Logger.h>
+#include <vector>
 
 class ISelectionCriterionObserver;
 
@@ -56,4 +57,8 @@ public:
 
     // Reset the modified status of the children
     void resetModifiedStatus();
+
+private:
+    /** States of all criteria, stored contiguously for fast rule evaluation */
+    std::vector<int> _criterionStates;
 };
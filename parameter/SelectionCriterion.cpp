@@ -38,9 +38,10 @@ using namespace core;
 
 CSelectionCriterion::CSelectionCriterion(const std::string &strName,
                                          const CSelectionCriterionType *pType,
-                                         core::log::Logger &logger)
-    : base(strName), _pType(pType), _logger(logger)
+                                         core::log::Logger &logger, std::vector<int> &states)
+    : base(strName), _pType(pType), _states(states), _stateIndex(states.size()), _logger(logger)
 {
+    _states.push_back(0);
 }
 
 std::string CSelectionCriterion::getKind() const
@@ -63,12 +64,16 @@ void CSelectionCriterion::resetModifiedStatus()
 void CSelectionCriterion::setCriterionState(int iState)
 {
     // Check for a change
-    if (_iState != iState) {
+    if (getCriterionState() != iState) {
 
-        _iState = iState;
+        _states[_stateIndex] = iState;
 
-        _logger.info() << "Selection criterion changed event: "
-                       << getFormattedDescription(false, false);
+        // Criteria may change often, do not describe them for nothing
+        if (_logger.isInfoEnabled()) {
+
+            _logger.info() << "Selection criterion changed event: "
+                           << getFormattedDescription(false, false);
+        }
 
         // Check if the previous criterion value has been taken into account (i.e. at least one
         // Configuration was applied
@@ -87,7 +92,17 @@ void CSelectionCriterion::setCriterionState(int iState)
 
 int CSelectionCriterion::getCriterionState() const
 {
-    return _iState;
+    return _states[_stateIndex];
+}
+
+size_t CSelectionCriterion::getStateIndex() const
+{
+    return _stateIndex;
+}
+
+const std::vector<int> &CSelectionCriterion::getStates() const
+{
+    return _states;
 }
 
 // Name
@@ -105,24 +120,24 @@ const ISelectionCriterionTypeInterface *CSelectionCriterion::getCriterionType()
 /// Match methods
 bool CSelectionCriterion::is(int iState) const
 {
-    return _iState == iState;
+    return getCriterionState() == iState;
 }
 
 bool CSelectionCriterion::isNot(int iState) const
 {
-    return _iState != iState;
+    return getCriterionState() != iState;
 }
 
 bool CSelectionCriterion::includes(int iState) const
 {
     // For inclusive criterion, Includes checks if ALL the bit sets in iState are set in the
-    // current _iState.
-    return (_iState & iState) == iState;
+    // current state.
+    return (getCriterionState() & iState) == iState;
 }
 
 bool CSelectionCriterion::excludes(int iState) const
 {
-    return (_iState & iState) == 0;
+    return (getCriterionState() & iState) == 0;
 }
 
 /// User request
@@ -157,7 +172,7 @@ std::string CSelectionCriterion::getFormattedDescription(bool bWithTypeInfo,
         }
 
         // Current State
-        strFormattedDescription += " = " + _pType->getFormattedState(_iState);
+        strFormattedDescription += " = " + _pType->getFormattedState(getCriterionState());
     } else {
         // Name
         strFormattedDescription = "Criterion name: " + getName();
@@ -169,7 +184,8 @@ std::string CSelectionCriterion::getFormattedDescription(bool bWithTypeInfo,
         }
 
         // Current State
-        strFormattedDescription += ", current state: " + _pType->getFormattedState(_iState);
+        strFormattedDescription +=
+            ", current state: " + _pType->getFormattedState(getCriterionState());
 
         if (bWithTypeInfo) {
             // States
@@ -184,7 +200,7 @@ void CSelectionCriterion::toXml(CXmlElement &xmlElement,
                                 CXmlSerializingContext &serializingContext) const
 {
     // Current Value
-    xmlElement.setAttribute("Value", _pType->getFormattedState(_iState));
+    xmlElement.setAttribute("Value", _pType->getFormattedState(getCriterionState()));
 
     // Serialize Type node
     _pType->toXml(xmlElement, serializingContext);
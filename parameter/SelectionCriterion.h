@@ -36,14 +36,23 @@
 #include <NonCopyable.hpp>
 
 #include <string>
+#include <vector>
 
 class CSelectionCriterion : public CElement,
                             public ISelectionCriterionInterface,
                             private utility::NonCopyable
 {
 public:
+    /** Constructor
+     *
+     * @param[in] strName criterion name
+     * @param[in] pType criterion type
+     * @param[in] logger application logger
+     * @param[in,out] states dense array of all criterion states, the state of the new criterion
+     *                       is appended to it
+     */
     CSelectionCriterion(const std::string &strName, const CSelectionCriterionType *pType,
-                        core::log::Logger &logger);
+                        core::log::Logger &logger, std::vector<int> &states);
 
     /// From ISelectionCriterionInterface
     // State
@@ -57,6 +66,11 @@ public:
     bool hasBeenModified() const;
     void resetModifiedStatus();
 
+    /** @return the index of the criterion state in the state array */
+    size_t getStateIndex() const;
+    /** @return the dense array holding the states of all criteria */
+    const std::vector<int> &getStates() const;
+
     /// Match methods
     bool is(int iState) const;
     bool isNot(int iState) const;
@@ -79,11 +93,13 @@ public:
     void toXml(CXmlElement &xmlElement, CXmlSerializingContext &serializingContext) const override;
 
 private:
-    // Current state
-    int _iState{0};
     // Type
     const CSelectionCriterionType *_pType;
 
+    /** States of all criteria, current state being at _stateIndex */
+    std::vector<int> &_states;
+    size_t _stateIndex;
+
     /** Counter to know how many modifications have been applied to this criterion */
     uint32_t _uiNbModifications{0};
 
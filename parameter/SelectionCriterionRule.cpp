@@ -139,6 +139,28 @@ bool CSelectionCriterionRule::matches() const
     }
 }
 
+// Criteria dependency
+void CSelectionCriterionRule::gatherCriteria(
+    std::set<const CSelectionCriterion *> &criteria) const
+{
+    assert(_pSelectionCriterion);
+
+    criteria.insert(_pSelectionCriterion);
+}
+
+// Compilation
+void CSelectionCriterionRule::compile(CRuleProgram &program, CRuleProgram::Label onMatch,
+                                      CRuleProgram::Label onMismatch) const
+{
+    assert(_pSelectionCriterion);
+
+    static const CRuleProgram::Opcode opcodes[ENbMatchesWhen] = {
+        CRuleProgram::EIs, CRuleProgram::EIsNot, CRuleProgram::EIncludes, CRuleProgram::EExcludes};
+
+    program.addTest(opcodes[_eMatchesWhen], _pSelectionCriterion->getStates(),
+                    _pSelectionCriterion->getStateIndex(), _iMatchValue, onMatch, onMismatch);
+}
+
 // From IXmlSink
 bool CSelectionCriterionRule::fromXml(const CXmlElement &xmlElement,
                                       CXmlSerializingContext &serializingContext)
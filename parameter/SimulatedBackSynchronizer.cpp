@@ -33,7 +33,8 @@
 #define base CBackSynchronizer
 
 CSimulatedBackSynchronizer::CSimulatedBackSynchronizer(
-    const CConfigurableElement *pConfigurableElement, CParameterBlackboard *pParameterBlackboard)
+    const CConfigurableElement *pConfigurableElement, CParameterBlackboard *pParameterBlackboard,
+    size_t /*maxThreads*/)
     : base(pConfigurableElement), _parameterAccessContext(_strError)
 {
     _parameterAccessContext.setParameterBlackboard(pParameterBlackboard);
@@ -39,8 +39,14 @@ class CParameterBlackboard;
 class CSimulatedBackSynchronizer : public CBackSynchronizer
 {
 public:
+    /**
+     * @param[in] pConfigurableElement the element to back synchronize
+     * @param[in] pParameterBlackboard the blackboard to back synchronize
+     * @param[in] maxThreads unused, setting default values does not access hardware
+     */
     CSimulatedBackSynchronizer(const CConfigurableElement *pConfigurableElement,
-                               CParameterBlackboard *pParameterBlackboard);
+                               CParameterBlackboard *pParameterBlackboard,
+                               size_t maxThreads = 1);
 
     // Back synchronization
     void sync() override;
@@ -35,6 +35,11 @@
 #include "ConfigurationAccessContext.h"
 #include "SubsystemObjectCreator.h"
 #include "MappingData.h"
+#include "SubsystemObject.h"
+#include "Utility.h"
+#include "SyncWorker.h"
+#include "ParameterBlackboard.h"
+#include "SyncerSet.h"
 #include <assert.h>
 #include <sstream>
 
@@ -56,6 +61,9 @@ CSubsystem::~CSubsystem()
 {
     // FIXME use unique_ptr, would make this method empty
 
+    // Already drained by the system class while derived subsystems were whole
+    _syncWorker.reset();
+
     for (auto *subsystemObject : _subsystemObjectList) {
 
         delete subsystemObject;
@@ -91,6 +99,155 @@ bool CSubsystem::needResync(bool /*bClear*/)
     return false;
 }
 
+// Synchronization
+bool CSubsystem::sync(const std::vector<ISyncer *> &syncers,
+                      CParameterBlackboard &parameterBlackboard, bool bBack, string &strError)
+{
+    std::vector<CSubsystemObject *> subsystemObjects;
+    subsystemObjects.reserve(syncers.size());
+
+    for (ISyncer *pSyncer : syncers) {
+
+        // Only subsystem objects are synchronized by their subsystem
+        subsystemObjects.push_back(static_cast<CSubsystemObject *>(pSyncer));
+    }
+
+#ifdef SIMULATION
+    return true;
+#endif
+
+    if (_syncWorker != nullptr && !bBack) {
+
+        postSync(subsystemObjects, parameterBlackboard);
+        return true;
+    }
+    // Objects may still be in use by the worker
+    waitForAsynchronousSync();
+
+    for (CSubsystemObject *pSubsystemObject : subsystemObjects) {
+
+        pSubsystemObject->bind(parameterBlackboard);
+    }
+    return syncSubsystemObjects(subsystemObjects, bBack, strError);
+}
+
+void CSubsystem::postSync(const std::vector<CSubsystemObject *> &subsystemObjects,
+                          const CParameterBlackboard &parameterBlackboard)
+{
+    // Snapshot the objects areas, at their offset within the subsystem
+    size_t subsystemOffset = getOffset();
+    auto snapshot = std::make_shared<CParameterBlackboard>();
+    snapshot->setSize(getFootPrint());
+
+    for (CSubsystemObject *pSubsystemObject : subsystemObjects) {
+
+        size_t offset;
+        size_t size;
+
+        pSubsystemObject->getBlackboardArea(offset, size);
+        parameterBlackboard.readBuffer(snapshot->getLocation(offset - subsystemOffset), size,
+                                       offset);
+    }
+
+    _syncWorker->post([this, subsystemObjects, snapshot, subsystemOffset] {
+        for (CSubsystemObject *pSubsystemObject : subsystemObjects) {
+
+            pSubsystemObject->bind(*snapshot, subsystemOffset);
+        }
+
+        string strError;
+        if (!syncSubsystemObjects(subsystemObjects, false, strError)) {
+
+            _asyncSyncErrors.push_back(strError);
+
+            // Areas were flagged clean when posted, have them synchronized again
+            std::lock_guard<std::mutex> lock(_asyncSyncFailuresMutex);
+            _asyncSyncFailures.insert(_asyncSyncFailures.end(), subsystemObjects.begin(),
+                                      subsystemObjects.end());
+        }
+    });
+}
+
+void CSubsystem::waitForAsynchronousSync() const
+{
+    if (_syncWorker != nullptr) {
+
+        _syncWorker->wait();
+    }
+}
+
+void CSubsystem::setAsynchronousSync(bool bAsynchronous)
+{
+    if (!bAsynchronous) {
+
+        // Complete posted synchronizations before stopping
+        _syncWorker.reset();
+    } else if (_syncWorker == nullptr) {
+
+        _syncWorker.reset(new CSyncWorker);
+    }
+}
+
+bool CSubsystem::fillFailedSyncerSet(CSyncerSet &syncerSet,
+                                     CParameterBlackboard &parameterBlackboard)
+{
+    std::vector<CSubsystemObject *> failures;
+    {
+        std::lock_guard<std::mutex> lock(_asyncSyncFailuresMutex);
+        failures.swap(_asyncSyncFailures);
+    }
+
+    for (CSubsystemObject *pSubsystemObject : failures) {
+
+        size_t offset;
+        size_t size;
+
+        pSubsystemObject->getBlackboardArea(offset, size);
+        parameterBlackboard.setDirty(offset, size);
+
+        syncerSet += pSubsystemObject;
+    }
+    return !failures.empty();
+}
+
+void CSubsystem::postSyncCompletion(SyncCompletion completion)
+{
+    if (_syncWorker == nullptr) {
+
+        completion({});
+        return;
+    }
+
+    _syncWorker->post([this, completion] {
+        core::Results errors;
+        errors.swap(_asyncSyncErrors);
+
+        completion(std::move(errors));
+    });
+}
+
+bool CSubsystem::syncSubsystemObjects(const std::vector<CSubsystemObject *> &subsystemObjects,
+                                      bool bBack, string &strError)
+{
+    std::list<string> errors;
+
+    for (CSubsystemObject *pSubsystemObject : subsystemObjects) {
+
+        string strObjectError;
+
+        if (!pSubsystemObject->synchronize(bBack, strObjectError)) {
+
+            errors.push_back(strObjectError);
+        }
+    }
+    if (!errors.empty()) {
+
+        strError = utility::asString(errors);
+        return false;
+    }
+    return true;
+}
+
 bool CSubsystem::structureFromXml(const CXmlElement &xmlElement,
                                   CXmlSerializingContext &serializingContext)
 {
@@ -34,9 +34,14 @@
 #include "ConfigurableElement.h"
 #include "Mapper.h"
 #include "MappingContext.h"
+#include "Syncer.h"
+#include "Results.h"
 #include <log/Logger.h>
 
+#include <functional>
 #include <list>
+#include <memory>
+#include <mutex>
 #include <stack>
 #include <string>
 #include <vector>
@@ -47,12 +52,18 @@ class CSubsystemObject;
 class CSubsystemObjectCreator;
 class CInstanceConfigurableElement;
 class CMappingData;
+class CSyncWorker;
 
-class PARAMETER_EXPORT CSubsystem : public CConfigurableElement, private IMapper
+class PARAMETER_EXPORT CSubsystem : public CConfigurableElement,
+                                     private IMapper,
+                                     private IBatchSyncer
 {
     // Subsystem objects iterator
     typedef std::list<CSubsystemObject *>::const_iterator SubsystemObjectListIterator;
 
+    // Subsystem objects are synchronized by their subsystem
+    friend class CSubsystemObject;
+
 public:
     /**
      * Class Constructor
@@ -96,6 +107,42 @@ public:
     virtual std::string getMapping(
         std::list<const CConfigurableElement *> &configurableElementPath) const;
 
+    /** Synchronize subsystem objects to hardware from a dedicated thread
+     *
+     * Once enabled, forward synchronizations are posted to a worker thread along with a
+     * snapshot of the blackboard areas of the objects to synchronize, instead of being run by
+     * the caller. Other synchronizations remain run by the caller, once the posted ones have
+     * completed.
+     *
+     * @param[in] bAsynchronous true to synchronize from a worker thread, false to synchronize
+     *                          from the caller (default behaviour)
+     */
+    void setAsynchronousSync(bool bAsynchronous);
+
+    /** Called with the errors of completed asynchronous synchronizations */
+    using SyncCompletion = std::function<void(core::Results &&errors)>;
+
+    /** Report completion of the asynchronous synchronizations posted so far
+     *
+     * @param[in] completion called from the worker thread once the synchronizations posted so
+     *                       far have completed, with the errors encountered since the previous
+     *                       report. Called immediately, without error, if synchronizations are
+     *                       not asynchronous.
+     */
+    void postSyncCompletion(SyncCompletion completion);
+
+    /** Schedule again the objects which asynchronous synchronization failed
+     *
+     * Their blackboard areas were flagged clean when their synchronization was posted: flag
+     * them dirty again and add the objects to the syncer set, so that the next synchronization
+     * retries them. To be called with the blackboard locked.
+     *
+     * @param[in,out] syncerSet the syncer set to add the failed objects to
+     * @param[in,out] parameterBlackboard the blackboard to flag the failed areas dirty in
+     * @return true if some objects have been scheduled again, false otherwise
+     */
+    bool fillFailedSyncerSet(CSyncerSet &syncerSet, CParameterBlackboard &parameterBlackboard);
+
 protected:
     // Used for simulation and virtual subsystems
     void setDefaultValues(CParameterAccessContext &parameterAccessContext) const override;
@@ -106,6 +153,23 @@ protected:
     // Subsystem object creator publication (strong reference)
     void addSubsystemObjectFactory(CSubsystemObjectCreator *pSubsystemObjectCreator);
 
+    /** Synchronize subsystem objects to/from hardware
+     *
+     * Called once per synchronization with all the subsystem objects to synchronize, e.g. all
+     * the modified ones when applying configurations. Objects are bound to the blackboard, so
+     * that their blackboard accesses are available.
+     *
+     * Override to coalesce hardware accesses, e.g. issue a single transaction for all objects.
+     * The default implementation synchronizes objects one by one.
+     *
+     * @param[in] subsystemObjects the subsystem objects to synchronize
+     * @param[in] bBack true to synchronize from hardware, false to synchronize to hardware
+     * @param[out] strError human readable error, in case of failure
+     * @return true if all objects have been synchronized, false otherwise
+     */
+    virtual bool syncSubsystemObjects(const std::vector<CSubsystemObject *> &subsystemObjects,
+                                      bool bBack, std::string &strError);
+
 private:
     CSubsystem(const CSubsystem &);
     CSubsystem &operator=(const CSubsystem &);
@@ -113,6 +177,21 @@ private:
     // Belonging subsystem
     const CSubsystem *getBelongingSubsystem() const override;
 
+    // From IBatchSyncer
+    bool sync(const std::vector<ISyncer *> &syncers, CParameterBlackboard &parameterBlackboard,
+              bool bBack, std::string &strError) override;
+
+    /** Post the forward synchronization of subsystem objects to the worker thread
+     *
+     * @param[in] subsystemObjects the subsystem objects to synchronize
+     * @param[in] parameterBlackboard the blackboard to snapshot the objects areas from
+     */
+    void postSync(const std::vector<CSubsystemObject *> &subsystemObjects,
+                  const CParameterBlackboard &parameterBlackboard);
+
+    /** Wait for posted synchronizations, if any, to complete */
+    void waitForAsynchronousSync() const;
+
     // Mapping execution
     bool mapSubsystemElements(std::string &strError);
 
@@ -251,4 +330,15 @@ private:
 
     /** Logger which has to be provided to subsystem objects */
     core::log::Logger &_logger;
+
+    /** Thread running forward synchronizations, if asynchronous */
+    std::unique_ptr<CSyncWorker> _syncWorker;
+
+    /** Errors of asynchronous synchronizations not reported yet, only accessed by the worker */
+    core::Results _asyncSyncErrors;
+
+    /** Objects which asynchronous synchronization failed, to synchronize again */
+    std::vector<CSubsystemObject *> _asyncSyncFailures;
+    /** Protects the failed objects, filled by the worker */
+    std::mutex _asyncSyncFailuresMutex;
 };
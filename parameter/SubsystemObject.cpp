@@ -66,7 +66,7 @@ string CSubsystemObject::getFormattedMappingValue() const
 // Blackboard data location
 uint8_t *CSubsystemObject::getBlackboardLocation() const
 {
-    return _blackboard->getLocation(getOffset());
+    return _blackboard->getLocation(getOffset() - _blackboardOffset);
 }
 
 // Size
@@ -91,6 +91,14 @@ int CSubsystemObject::toPlainInteger(
     return sizeOptimizedData;
 }
 
+bool CSubsystemObject::getBlackboardArea(size_t &offset, size_t &size) const
+{
+    offset = getOffset();
+    size = _dataSize;
+
+    return true;
+}
+
 // Default back synchronization
 void CSubsystemObject::setDefaultValues(CParameterBlackboard &parameterBlackboard) const
 {
@@ -105,12 +113,32 @@ void CSubsystemObject::setDefaultValues(CParameterBlackboard &parameterBlackboar
 
 // Synchronization
 bool CSubsystemObject::sync(CParameterBlackboard &parameterBlackboard, bool bBack, string &strError)
+{
+    // Subsystem worker may still be synchronizing this object
+    getSubsystem()->waitForAsynchronousSync();
+
+    bind(parameterBlackboard);
+
+    return synchronize(bBack, strError);
+}
+
+IBatchSyncer *CSubsystemObject::getBatchSyncer() const
+{
+    // Subsystems decide how their objects are synchronized
+    return const_cast<CSubsystem *>(getSubsystem());
+}
+
+void CSubsystemObject::bind(CParameterBlackboard &parameterBlackboard, size_t blackboardOffset)
 {
     // Get blackboard location
     _blackboard = &parameterBlackboard;
+    _blackboardOffset = blackboardOffset;
     // Access index init
     _accessedIndex = 0;
+}
 
+bool CSubsystemObject::synchronize(bool bBack, string &strError)
+{
 #ifdef SIMULATION
     return true;
 #endif
@@ -133,7 +161,7 @@ bool CSubsystemObject::sync(CParameterBlackboard &parameterBlackboard, bool bBac
         // Fall back to parameter default initialization
         if (bBack) {
 
-            setDefaultValues(parameterBlackboard);
+            setDefaultValues(*_blackboard);
         }
         return false;
     }
@@ -173,14 +201,14 @@ bool CSubsystemObject::accessHW(bool bReceive, string &strError)
 // Blackboard access from subsystems
 void CSubsystemObject::blackboardRead(void *pvData, size_t size)
 {
-    _blackboard->readBuffer(pvData, size, getOffset() + _accessedIndex);
+    _blackboard->readBuffer(pvData, size, getOffset() - _blackboardOffset + _accessedIndex);
 
     _accessedIndex += size;
 }
 
 void CSubsystemObject::blackboardWrite(const void *pvData, size_t size)
 {
-    _blackboard->writeBuffer(pvData, size, getOffset() + _accessedIndex);
+    _blackboard->writeBuffer(pvData, size, getOffset() - _blackboardOffset + _accessedIndex);
 
     _accessedIndex += size;
 }
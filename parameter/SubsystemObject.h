@@ -43,6 +43,9 @@ class CSubsystem;
 
 class PARAMETER_EXPORT CSubsystemObject : private ISyncer
 {
+    // Batched synchronization of a subsystem objects
+    friend class CSubsystem;
+
 public:
     CSubsystemObject(CInstanceConfigurableElement *pInstanceConfigurableElement,
                      core::log::Logger &logger);
@@ -88,6 +91,19 @@ protected:
     // Belonging Subsystem retrieval
     const CSubsystem *getSubsystem() const;
 
+    /** Synchronize the object to/from hardware
+     *
+     * Checks the subsystem health, accesses the hardware through accessHW() and falls back to
+     * default values when back synchronization fails. Intended for subsystems overriding
+     * CSubsystem::syncSubsystemObjects(): the object must be bound to the blackboard, which is
+     * the case for every object handed to that hook.
+     *
+     * @param[in] bBack true to synchronize from hardware, false to synchronize to hardware
+     * @param[out] strError human readable error, in case of failure
+     * @return true on success, false otherwise
+     */
+    bool synchronize(bool bBack, std::string &strError);
+
     /** Logging methods
      *@{
      */
@@ -101,6 +117,16 @@ private:
      *  as if not called, plugins will not work (sets _blackboard).
      */
     bool sync(CParameterBlackboard &parameterBlackboard, bool bBack, std::string &strError) final;
+    bool getBlackboardArea(size_t &offset, size_t &size) const final;
+    IBatchSyncer *getBatchSyncer() const final;
+
+    /** Set the blackboard to synchronize, before accessing it
+     *
+     * @param[in] parameterBlackboard the blackboard to synchronize
+     * @param[in] blackboardOffset the offset of the blackboard content in the main blackboard,
+     *                             not null when synchronizing a snapshot of part of it
+     */
+    void bind(CParameterBlackboard &parameterBlackboard, size_t blackboardOffset = 0);
 
     // Default back synchronization
     void setDefaultValues(CParameterBlackboard &parameterBlackboard) const;
@@ -123,6 +149,8 @@ private:
     size_t _dataSize;
     // Blackboard data location
     CParameterBlackboard *_blackboard{nullptr};
+    // Offset of the blackboard content in the main blackboard
+    size_t _blackboardOffset{0};
     // Accessed index for Subsystem read/write from/to blackboard
     size_t _accessedIndex{0};
 };
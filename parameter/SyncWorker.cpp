@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "SyncWorker.h"
+
+CSyncWorker::CSyncWorker() : _thread(&CSyncWorker::run, this)
+{
+}
+
+CSyncWorker::~CSyncWorker()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _bStopping = true;
+    }
+    _condition.notify_all();
+    _thread.join();
+}
+
+void CSyncWorker::post(Job job)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _jobs.push_back(std::move(job));
+    }
+    _condition.notify_all();
+}
+
+void CSyncWorker::wait()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    _condition.wait(lock, [this] { return _jobs.empty() && !_bBusy; });
+}
+
+void CSyncWorker::run()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    while (true) {
+
+        _condition.wait(lock, [this] { return !_jobs.empty() || _bStopping; });
+
+        if (_jobs.empty()) {
+
+            // Stopping with nothing left to run
+            return;
+        }
+        Job job = std::move(_jobs.front());
+        _jobs.pop_front();
+        _bBusy = true;
+
+        // Run without blocking job posting
+        lock.unlock();
+        job();
+        lock.lock();
+
+        _bBusy = false;
+        _condition.notify_all();
+    }
+}
@@ -29,9 +29,12 @@
  */
 #pragma once
 
+#include <cstddef>
 #include <string>
+#include <vector>
 
 class CParameterBlackboard;
+class IBatchSyncer;
 
 class ISyncer
 {
@@ -39,6 +42,43 @@ public:
     virtual bool sync(CParameterBlackboard &parameterBlackboard, bool bBack,
                       std::string &strError) = 0;
 
+    /** Get the blackboard area synchronized by this syncer
+     *
+     * @param[out] offset the area offset in the blackboard
+     * @param[out] size the area size
+     * @return false if the area is unknown, true otherwise
+     */
+    virtual bool getBlackboardArea(size_t & /*offset*/, size_t & /*size*/) const
+    {
+        return false;
+    }
+
+    /** Get the synchronizer able to synchronize this syncer along with others in one go
+     *
+     * @return the batch syncer, nullptr if this syncer is synchronized alone
+     */
+    virtual IBatchSyncer *getBatchSyncer() const { return nullptr; }
+
 protected:
     virtual ~ISyncer() = default;
 };
+
+/** Synchronizer of several syncers in one go, e.g. to coalesce hardware accesses */
+class IBatchSyncer
+{
+public:
+    /** Synchronize syncers
+     *
+     * @param[in] syncers the syncers to synchronize, all having this batch syncer
+     * @param[in] parameterBlackboard blackboard to synchronize
+     * @param[in] bBack indicates if we want to back synchronise or to forward synchronise
+     * @param[out] strError human readable error, in case of failure
+     * @return true if all syncers have been synchronized, false otherwise
+     */
+    virtual bool sync(const std::vector<ISyncer *> &syncers,
+                      CParameterBlackboard &parameterBlackboard, bool bBack,
+                      std::string &strError) = 0;
+
+protected:
+    virtual ~IBatchSyncer() = default;
+};
@@ -29,42 +29,162 @@
  */
 #include "SyncerSet.h"
 #include "Syncer.h"
+#include "ParameterBlackboard.h"
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <utility>
+
+CSyncerSet::Entry::Entry(ISyncer *syncer)
+    : offset(std::numeric_limits<size_t>::max()), pSyncer(syncer)
+{
+    size_t size;
+
+    syncer->getBlackboardArea(offset, size);
+}
+
+bool CSyncerSet::Entry::operator<(const Entry &right) const
+{
+    // Syncers sharing an offset are equivalent, they keep their insertion order
+    return offset < right.offset;
+}
+
+bool CSyncerSet::Entry::operator==(const Entry &right) const
+{
+    return pSyncer == right.pSyncer;
+}
 
 const CSyncerSet &CSyncerSet::operator+=(ISyncer *pRightSyncer)
 {
-    _syncerSet.insert(pRightSyncer);
+    Entry entry(pRightSyncer);
+
+    // Syncers are mostly added in offset order
+    if (_syncers.empty() || _syncers.back() < entry) {
+
+        _syncers.push_back(entry);
+        return *this;
+    }
+
+    // Syncers sharing an offset are rare, a linear search among them is enough
+    auto sameOffset = std::equal_range(_syncers.begin(), _syncers.end(), entry);
 
+    if (std::find(sameOffset.first, sameOffset.second, entry) == sameOffset.second) {
+
+        // Insert after the syncers sharing its offset
+        _syncers.insert(sameOffset.second, entry);
+    }
     return *this;
 }
 
 const CSyncerSet &CSyncerSet::operator+=(const CSyncerSet &rightSyncerSet)
 {
-    if (&rightSyncerSet != this) {
+    const std::vector<Entry> &right = rightSyncerSet._syncers;
 
-        _syncerSet.insert(rightSyncerSet._syncerSet.begin(), rightSyncerSet._syncerSet.end());
+    if (&rightSyncerSet == this || right.empty()) {
+
+        return *this;
+    }
+    if (_syncers.empty() || _syncers.back() < right.front()) {
+
+        _syncers.insert(_syncers.end(), right.begin(), right.end());
+        return *this;
     }
 
+    // Stable: among syncers sharing an offset, the ones of this set come first
+    std::vector<Entry> merged;
+    merged.reserve(_syncers.size() + right.size());
+
+    std::merge(_syncers.begin(), _syncers.end(), right.begin(), right.end(),
+               std::back_inserter(merged));
+
+    // Drop the syncers of both sets, duplicates share their offset
+    _syncers.clear();
+
+    for (const Entry &entry : merged) {
+
+        auto sameOffset = std::lower_bound(_syncers.begin(), _syncers.end(), entry);
+
+        if (std::find(sameOffset, _syncers.end(), entry) == _syncers.end()) {
+
+            _syncers.push_back(entry);
+        }
+    }
     return *this;
 }
 
 void CSyncerSet::clear()
 {
-    _syncerSet.clear();
+    _syncers.clear();
+}
+
+std::vector<CSyncerSet> CSyncerSet::splitByBatchSyncer() const
+{
+    std::vector<IBatchSyncer *> batchSyncers;
+    std::vector<CSyncerSet> syncerSets;
+
+    for (const Entry &entry : _syncers) {
+
+        IBatchSyncer *pBatchSyncer = entry.pSyncer->getBatchSyncer();
+
+        // Syncers synchronized alone get a set of their own
+        auto it = pBatchSyncer == nullptr
+                      ? batchSyncers.end()
+                      : std::find(batchSyncers.begin(), batchSyncers.end(), pBatchSyncer);
+
+        if (it == batchSyncers.end()) {
+
+            batchSyncers.push_back(pBatchSyncer);
+            syncerSets.emplace_back();
+            it = std::prev(batchSyncers.end());
+        }
+        // Entries are visited in order, sets remain sorted
+        syncerSets[it - batchSyncers.begin()]._syncers.push_back(entry);
+    }
+    return syncerSets;
 }
 
 bool CSyncerSet::sync(CParameterBlackboard &parameterBlackboard, bool bBack,
-                      core::Results *errors) const
+                      core::Results *errors, bool bDirtyOnly) const
 {
     bool bSuccess = true;
 
     std::string strError;
 
+    // Syncers to synchronize in one go, in order of their first syncer
+    std::vector<std::pair<IBatchSyncer *, std::vector<ISyncer *>>> batches;
+
     // Propagate
-    SyncerSetConstIterator it;
+    for (const Entry &entry : _syncers) {
+
+        ISyncer *pSyncer = entry.pSyncer;
+
+        size_t offset;
+        size_t size;
+        bool bAreaKnown = pSyncer->getBlackboardArea(offset, size);
 
-    for (it = _syncerSet.begin(); it != _syncerSet.end(); ++it) {
+        // Blackboard area unchanged since last synchronization
+        if (!bBack && bDirtyOnly && bAreaKnown && !parameterBlackboard.isDirty(offset, size)) {
 
-        ISyncer *pSyncer = *it;
+            continue;
+        }
+
+        IBatchSyncer *pBatchSyncer = pSyncer->getBatchSyncer();
+
+        if (pBatchSyncer != nullptr) {
+
+            // Few batch syncers (one per subsystem), a linear search is enough
+            auto batch = std::find_if(batches.begin(), batches.end(),
+                                      [pBatchSyncer](const decltype(batches)::value_type &batch) {
+                                          return batch.first == pBatchSyncer;
+                                      });
+            if (batch == batches.end()) {
+
+                batches.emplace_back(pBatchSyncer, std::vector<ISyncer *>());
+                batch = std::prev(batches.end());
+            }
+            batch->second.push_back(pSyncer);
+            continue;
+        }
 
         if (!pSyncer->sync(parameterBlackboard, bBack, strError)) {
 
@@ -73,7 +193,37 @@ bool CSyncerSet::sync(CParameterBlackboard &parameterBlackboard, bool bBack,
                 errors->push_back(strError);
             }
             bSuccess = false;
+        } else if (bAreaKnown) {
+
+            parameterBlackboard.clearDirty(offset, size);
+        }
+    }
+    for (const auto &batch : batches) {
+
+        if (!batch.first->sync(batch.second, parameterBlackboard, bBack, strError)) {
+
+            if (errors != nullptr) {
+
+                errors->push_back(strError);
+            }
+            bSuccess = false;
+            continue;
+        }
+        for (ISyncer *pSyncer : batch.second) {
+
+            size_t offset;
+            size_t size;
+
+            if (pSyncer->getBlackboardArea(offset, size)) {
+
+                parameterBlackboard.clearDirty(offset, size);
+            }
         }
     }
+    if (bBack) {
+
+        // Syncers wrote to the blackboard through CParameterBlackboard::getLocation
+        parameterBlackboard.setModified();
+    }
     return bSuccess;
 }
@@ -30,15 +30,20 @@
 #pragma once
 
 #include "Results.h"
-#include <set>
+#include <cstddef>
+#include <vector>
 
 class ISyncer;
 class CParameterBlackboard;
 
+/** Set of syncers, ordered by blackboard offset
+ *
+ * Syncers sharing an offset, e.g. syncers of unknown area, keep their insertion order.
+ * Synchronization order thus only depends on the structure and on the order syncers are added
+ * in, hence is reproducible across runs.
+ */
 class CSyncerSet
 {
-    typedef std::set<ISyncer *>::const_iterator SyncerSetConstIterator;
-
 public:
     // Filling
     const CSyncerSet &operator+=(ISyncer *pRightSyncer);
@@ -47,15 +52,42 @@ public:
     // Clearing
     void clear();
 
+    /** Split the set into independently synchronizable sets, i.e. by subsystem
+     *
+     * @return in order of their first syncer, one set per batch syncer and one set per syncer
+     *         synchronized alone
+     */
+    std::vector<CSyncerSet> splitByBatchSyncer() const;
+
     /** Sync the blackboard
+     *
+     * Syncers are synchronized in blackboard offset order. Syncers sharing a batch syncer are
+     * synchronized together by a single call to it, after the other syncers, in order of their
+     * first syncer. Successfully synchronized blackboard areas are flagged as clean.
      *
      * @param parameterBlackboard blackboard associated to syncer
      * @param[in] bBack indicates if we want to back synchronise or to forward synchronise
      * @param[out] errors, errors encountered during restoration
+     * @param[in] bDirtyOnly when forward synchronizing, skip syncers whose blackboard area is
+     *                       clean
      * @return true if success false otherwise
      */
-    bool sync(CParameterBlackboard &parameterBlackboard, bool bBack, core::Results *errors) const;
+    bool sync(CParameterBlackboard &parameterBlackboard, bool bBack, core::Results *errors,
+              bool bDirtyOnly = false) const;
 
 private:
-    std::set<ISyncer *> _syncerSet;
+    struct Entry
+    {
+        Entry(ISyncer *syncer);
+
+        bool operator<(const Entry &right) const;
+        bool operator==(const Entry &right) const;
+
+        /** Blackboard offset of the syncer area, syncers of unknown area coming last */
+        size_t offset;
+        ISyncer *pSyncer;
+    };
+
+    /** Syncers sorted by blackboard offset then insertion order, without duplicates */
+    std::vector<Entry> _syncers;
 };
@@ -30,6 +30,7 @@
 #include <algorithm>
 #include "SystemClass.h"
 #include "SubsystemLibrary.h"
+#include "ParameterBlackboard.h"
 #include "VirtualSubsystem.h"
 #include "LoggingElementBuilderTemplate.h"
 #include <cassert>
@@ -37,6 +38,7 @@
 #include "DynamicLibrary.hpp"
 #include "Utility.h"
 #include "Memory.hpp"
+#include <mutex>
 
 #define base CConfigurableElement
 
@@ -58,10 +60,17 @@ using namespace core;
 CSystemClass::CSystemClass(log::Logger &logger)
     : _pSubsystemLibrary(new CSubsystemLibrary()), _logger(logger)
 {
+    std::promise<core::Results> synchronous;
+    synchronous.set_value({});
+    _synchronousCompletion = synchronous.get_future().share();
 }
 
 CSystemClass::~CSystemClass()
 {
+    // Complete posted synchronizations while subsystems are still whole: the ones still pending
+    // when a subsystem base class is destroyed would reach its destroyed derived class
+    setAsynchronousSync(false);
+
     delete _pSubsystemLibrary;
 
     // Destroy child subsystems *before* unloading the libraries (otherwise crashes will occur
@@ -225,7 +234,9 @@ const CSubsystemLibrary *CSystemClass::getSubsystemLibrary() const
     return _pSubsystemLibrary;
 }
 
-void CSystemClass::checkForSubsystemsToResync(CSyncerSet &syncerSet, core::Results &infos)
+void CSystemClass::checkForSubsystemsToResync(CSyncerSet &syncerSet,
+                                              CParameterBlackboard &parameterBlackboard,
+                                              core::Results &infos)
 {
     size_t uiNbChildren = getNbChildren();
     size_t uiChild;
@@ -240,10 +251,102 @@ void CSystemClass::checkForSubsystemsToResync(CSyncerSet &syncerSet, core::Resul
             infos.push_back("Resynchronizing subsystem: " + pSubsystem->getName());
             // get all subsystem syncers
             pSubsystem->fillSyncerSet(syncerSet);
+            // and make sure none of them is skipped
+            parameterBlackboard.setDirty(pSubsystem->getOffset(), pSubsystem->getFootPrint());
+        }
+        // Retry failed asynchronous synchronizations
+        if (pSubsystem->fillFailedSyncerSet(syncerSet, parameterBlackboard)) {
+
+            infos.push_back("Retrying failed synchronization of subsystem: " +
+                            pSubsystem->getName());
         }
     }
 }
 
+void CSystemClass::setAsynchronousSync(bool bAsynchronous)
+{
+    _bAsynchronousSync = bAsynchronous;
+
+    size_t uiNbChildren = getNbChildren();
+    size_t uiChild;
+
+    for (uiChild = 0; uiChild < uiNbChildren; uiChild++) {
+
+        static_cast<CSubsystem *>(getChild(uiChild))->setAsynchronousSync(bAsynchronous);
+    }
+}
+
+std::shared_future<core::Results> CSystemClass::getSyncCompletion()
+{
+    if (!_bAsynchronousSync) {
+
+        // Nothing posted
+        return _synchronousCompletion;
+    }
+    // Errors of all subsystems, reported by the last one to complete
+    struct Completion
+    {
+        std::mutex mutex;
+        size_t pending;
+        core::Results errors;
+        std::promise<core::Results> promise;
+    };
+    auto completion = std::make_shared<Completion>();
+    std::shared_future<core::Results> future = completion->promise.get_future().share();
+
+    size_t uiNbChildren = getNbChildren();
+    completion->pending = uiNbChildren;
+
+    if (uiNbChildren == 0) {
+
+        completion->promise.set_value({});
+        return future;
+    }
+
+    for (size_t uiChild = 0; uiChild < uiNbChildren; uiChild++) {
+
+        static_cast<CSubsystem *>(getChild(uiChild))
+            ->postSyncCompletion([completion](core::Results &&errors) {
+                std::lock_guard<std::mutex> lock(completion->mutex);
+
+                completion->errors.splice(completion->errors.end(), errors);
+
+                if (--completion->pending == 0) {
+
+                    completion->promise.set_value(std::move(completion->errors));
+                }
+            });
+    }
+    return future;
+}
+
+void CSystemClass::indexElementPaths()
+{
+    _elementsByPath.clear();
+
+    indexElementPaths(this);
+}
+
+void CSystemClass::indexElementPaths(const CConfigurableElement *pConfigurableElement)
+{
+    _elementsByPath.emplace(pConfigurableElement->getPath(), pConfigurableElement);
+
+    size_t uiNbChildren = pConfigurableElement->getNbChildren();
+
+    for (size_t uiChild = 0; uiChild < uiNbChildren; uiChild++) {
+
+        indexElementPaths(
+            static_cast<const CConfigurableElement *>(pConfigurableElement->getChild(uiChild)));
+    }
+}
+
+const CConfigurableElement *CSystemClass::findIndexedElement(const string &strPath) const
+{
+    auto it = _elementsByPath.find(strPath);
+
+    return it != _elementsByPath.end() ? it->second : nullptr;
+}
+
 void CSystemClass::cleanSubsystemsNeedToResync()
 {
     size_t uiNbChildren = getNbChildren();
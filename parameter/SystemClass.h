@@ -33,11 +33,14 @@
 #include "SubsystemPlugins.h"
 #include "Results.h"
 #include <log/Logger.h>
+#include <future>
 #include <list>
 #include <string>
 #include <memory>
+#include <unordered_map>
 
 class CSubsystemLibrary;
+class CParameterBlackboard;
 class DynamicLibrary;
 
 class CSystemClass final : public CConfigurableElement
@@ -67,19 +70,53 @@ public:
 
     /**
       * Look for subsystems that need to be resynchronized.
-      * Consume the need to be resynchronized
-      * and fill a syncer set with all syncers that need to be resynchronized
+      * Consume the need to be resynchronized, flag the subsystems blackboard areas as dirty
+      * and fill a syncer set with all syncers that need to be resynchronized.
+      * Subsystem objects which asynchronous synchronization failed are resynchronized as well.
       *
       * @param[out] syncerSet The syncer set to fill
+      * @param[in] parameterBlackboard The main blackboard
       * @param[out] infos Relevant informations client may want to log
       */
-    void checkForSubsystemsToResync(CSyncerSet &syncerSet, core::Results &infos);
+    void checkForSubsystemsToResync(CSyncerSet &syncerSet,
+                                    CParameterBlackboard &parameterBlackboard,
+                                    core::Results &infos);
 
     /**
       * Reset subsystems need to resync flag.
       */
     void cleanSubsystemsNeedToResync();
 
+    /** Synchronize subsystem objects from per subsystem worker threads
+     *
+     * @see CSubsystem::setAsynchronousSync
+     *
+     * @param[in] bAsynchronous true to synchronize asynchronously, false otherwise
+     */
+    void setAsynchronousSync(bool bAsynchronous);
+
+    /** Get the completion of the asynchronous synchronizations posted so far
+     *
+     * Costless when synchronizing synchronously: a ready future is shared.
+     *
+     * @return a future made ready once all subsystems have completed the synchronizations
+     *         posted so far, holding the errors they encountered.
+     */
+    std::shared_future<core::Results> getSyncCompletion();
+
+    /** Index the system class and its descendants by path
+     *
+     * The structure being immutable once loaded, to be called once it is.
+     */
+    void indexElementPaths();
+
+    /** Find an element by path in constant time
+     *
+     * @param[in] strPath the element path, e.g. /SystemClass/Subsystem/Element
+     * @return the element, nullptr if not indexed
+     */
+    const CConfigurableElement *findIndexedElement(const std::string &strPath) const;
+
     // base
     std::string getKind() const override;
 
@@ -92,6 +129,9 @@ private:
     // base
     bool childrenAreDynamic() const override;
 
+    /** Index an element and its descendants by path */
+    void indexElementPaths(const CConfigurableElement *pConfigurableElement);
+
     /** Load shared libraries subsystem plugins.
      *
      * @param[out] errors is the list of error that occured during loadings.
@@ -122,6 +162,15 @@ private:
     /** Application Logger we need to provide to plugins */
     core::log::Logger &_logger;
 
+    /** Whether subsystems synchronize asynchronously, see setAsynchronousSync() */
+    bool _bAsynchronousSync{false};
+
+    /** Ready completion, shared while synchronizing synchronously */
+    std::shared_future<core::Results> _synchronousCompletion;
+
+    /** Elements by path, filled once the structure is loaded */
+    std::unordered_map<std::string, const CConfigurableElement *> _elementsByPath;
+
     /** The entry point symbol that must be implemented by plugins
      */
     static const char entryPointSymbol[];
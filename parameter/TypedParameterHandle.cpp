@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "TypedParameterHandle.h"
+#include "ParameterMgr.h"
+#include "BaseParameter.h"
+#include "ParameterType.h"
+#include "ParameterAccessContext.h"
+#include "ParameterBlackboard.h"
+#include "Syncer.h"
+
+#include <mutex>
+
+using std::string;
+using std::mutex;
+using std::lock_guard;
+
+template <class T>
+TypedParameterHandle<T>::TypedParameterHandle(const CBaseParameter &parameter,
+                                              CParameterMgr &parameterMgr)
+    : mParameter(parameter), mParameterMgr(parameterMgr),
+      mType(parameter.getType() == CInstanceConfigurableElement::EParameter
+                ? static_cast<const CParameterType *>(parameter.getTypeElement())
+                : nullptr),
+      mOffset(parameter.getOffset()), mSize(parameter.getFootPrint()),
+      mSyncer(parameter.getSyncer())
+{
+}
+
+template <class T>
+string TypedParameterHandle<T>::getPath() const
+{
+    return mParameter.getPath();
+}
+
+template <class T>
+bool TypedParameterHandle<T>::set(T value, string &error)
+{
+    // Ensure we're safe against blackboard foreign access
+    CParameterMgr::CBlackboardWriteLock autoLock(mParameterMgr);
+
+    // When in tuning mode, silently skip "set" requests
+    if (mParameterMgr.tuningModeOn()) {
+
+        return true;
+    }
+    if (!isRogue()) {
+
+        error = "Can not set parameter \"" + getPath() + "\" as it is not rogue.";
+        return false;
+    }
+    CParameterBlackboard *pBlackboard = mParameterMgr.getParameterBlackboard();
+    CParameterAccessContext parameterAccessContext(error, pBlackboard);
+
+    if (mType == nullptr) {
+
+        return mParameter.access(value, true, parameterAccessContext);
+    }
+    uint32_t uiData;
+
+    if (!mType->toBlackboard(value, uiData, parameterAccessContext)) {
+
+        error += " " + getPath();
+        return false;
+    }
+    // Beware this code works on little endian architectures only!
+    pBlackboard->writeInteger(&uiData, mSize, mOffset);
+
+    // Synchronize
+    if (mSyncer == nullptr) {
+
+        error = "Unable to synchronize modification. No Syncer object associated to "
+                "configurable element: " +
+                getPath();
+        return false;
+    }
+    if (!mSyncer->sync(*pBlackboard, false, error)) {
+
+        error += " " + getPath();
+        return false;
+    }
+    size_t offset;
+    size_t size;
+
+    // Synchronized, not to be synchronized again by the next configuration application
+    if (mSyncer->getBlackboardArea(offset, size)) {
+
+        pBlackboard->clearDirty(offset, size);
+    }
+    return true;
+}
+
+template <class T>
+bool TypedParameterHandle<T>::get(T &value, string &error) const
+{
+    // Ensure we're safe against blackboard foreign access
+    lock_guard<mutex> autoLock(mParameterMgr.getBlackboardMutex());
+
+    CParameterBlackboard *pBlackboard = mParameterMgr.getParameterBlackboard();
+    CParameterAccessContext parameterAccessContext(error, pBlackboard);
+
+    if (mType == nullptr) {
+
+        return mParameter.access(value, false, parameterAccessContext);
+    }
+    uint32_t uiData = 0;
+
+    // Beware this code works on little endian architectures only!
+    pBlackboard->readInteger(&uiData, mSize, mOffset);
+
+    if (!mType->fromBlackboard(value, uiData, parameterAccessContext)) {
+
+        error += " " + getPath();
+        return false;
+    }
+    return true;
+}
+
+template <class T>
+bool TypedParameterHandle<T>::isRogue()
+{
+    // Domains may only be modified during tuning sessions
+    uint64_t tuningSession = mParameterMgr.getTuningSessionCount();
+
+    if (mRogueTuningSession != tuningSession) {
+
+        mRogue = mParameter.isRogue();
+        mRogueTuningSession = tuningSession;
+    }
+    return mRogue;
+}
+
+template class TypedParameterHandle<bool>;
+template class TypedParameterHandle<uint32_t>;
+template class TypedParameterHandle<int32_t>;
+template class TypedParameterHandle<double>;
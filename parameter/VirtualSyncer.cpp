@@ -52,3 +52,11 @@ bool CVirtualSyncer::sync(CParameterBlackboard &parameterBlackboard, bool bBack,
 
     return true;
 }
+
+bool CVirtualSyncer::getBlackboardArea(size_t &offset, size_t &size) const
+{
+    offset = _pConfigurableElement->getOffset();
+    size = _pConfigurableElement->getFootPrint();
+
+    return true;
+}
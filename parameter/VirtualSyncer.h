@@ -41,6 +41,7 @@ public:
     // from ISyncer
     bool sync(CParameterBlackboard &parameterBlackboard, bool bBack,
               std::string &strError) override;
+    bool getBlackboardArea(size_t &offset, size_t &size) const override;
 
 private:
     const CConfigurableElement *_pConfigurableElement;
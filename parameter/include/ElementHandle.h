@@ -227,6 +227,7 @@ public:
 protected:
     ElementHandle(CConfigurableElement &element, CParameterMgr &parameterMgr);
     friend CParameterMgr; // So that it can build the handler
+    friend class ParameterTransaction; // So that it can stage writes of the element
 
 private:
     template <class T>
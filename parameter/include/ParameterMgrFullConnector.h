@@ -36,6 +36,7 @@
 #include "ParameterHandle.h"
 #include "ParameterMgrLoggerForward.h"
 #include "ParameterMgrPlatformConnector.h"
+#include "ParameterTransaction.h"
 #include "CommandHandlerInterface.h"
 
 #include <string>
@@ -66,6 +67,14 @@ public:
      */
     CommandHandlerInterface *createCommandHandler();
 
+    /** Create a transaction, to apply writes of several elements at once
+     *
+     * Must be called after successful start.
+     *
+     * @returns an empty transaction, see ParameterTransaction
+     */
+    ParameterTransaction createTransaction();
+
     /** @deprecated Same as its overload without error handling.
      * @note this deprecated method in not available in the python wrapper.
      */
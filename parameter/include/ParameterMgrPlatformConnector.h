@@ -35,8 +35,13 @@
 #include "SelectionCriterionInterface.h"
 #include "ParameterHandle.h"
 #include "ElementHandle.h"
+#include "TypedParameterHandle.h"
 #include "ParameterMgrLoggerForward.h"
 
+#include <future>
+#include <list>
+#include <string>
+
 class CParameterMgr;
 
 class PARAMETER_EXPORT CParameterMgrPlatformConnector
@@ -48,6 +53,8 @@ public:
      *
      * Override info and warning methods to specify how each log level
      * should be printed.
+     * Override isInfoEnabled and isWarningEnabled to discard a log level: its logs are then
+     * not even formatted, which saves time on hot paths such as criterion changes.
      *
      * @note Errors are always returned synchronously. Never logged.
      */
@@ -57,6 +64,9 @@ public:
         virtual void info(const std::string &strLog) = 0;
         virtual void warning(const std::string &strLog) = 0;
 
+        virtual bool isInfoEnabled() const { return true; }
+        virtual bool isWarningEnabled() const { return true; }
+
     protected:
         virtual ~ILogger() {}
     };
@@ -107,6 +117,22 @@ public:
      */
     ElementHandle *createElementHandle(const std::string &path, std::string &error) const;
 
+    /** Creates a typed handle to a scalar parameter, see TypedParameterHandle.
+     *
+     * The returned object is owned by the client who is responsible to delete it.
+     *
+     * @tparam T the type the parameter is accessed as, one of bool, uint32_t, int32_t, double
+     * @param[in] path A string representing a path to a scalar parameter.
+     * @param[out] error On error: an human readable error message
+     *                   On success: undefined
+     *
+     * @return A typed parameter handle on success
+     *         NULL on error
+     */
+    template <class T>
+    TypedParameterHandle<T> *createTypedParameterHandle(const std::string &path,
+                                                        std::string &error) const;
+
     /** Is the remote interface forcefully disabled ?
      */
     bool getForceNoRemoteInterface() const;
@@ -187,12 +213,132 @@ public:
      */
     bool getValidateSchemasOnStart() const;
 
+    /** Should domains of distinct subsystems be applied concurrently?
+     *
+     * Will fail if called on started instance.
+     *
+     * @param[in] bParallel:
+     *     If set to true, domains not sharing any subsystem are restored and synchronized by
+     *         distinct threads. Subsystem plugins and the logger must then support being called
+     *         concurrently for different subsystems.
+     *     If set to false, domains are applied one after the other (default behaviour)
+     * @param[out] strError On error: an human readable error message
+     *                      On success: undefined
+     *
+     * @return false if unable to set, true otherwise.
+     */
+    bool setParallelApply(bool bParallel, std::string &strError);
+
+    /** Would domains of distinct subsystems be applied concurrently?
+     *
+     * @return parallel application policy state.
+     */
+    bool getParallelApply() const;
+
+    /** Should domains memorize their applicable configuration per criterion states?
+     *
+     * Will fail if called on started instance.
+     *
+     * @param[in] bDecisionTable:
+     *     If set to true, each domain memorizes the configuration found applicable for the
+     *         states of the criteria it depends on (up to 4 criteria), and skips application
+     *         rule evaluation when these states come back
+     *     If set to false, rules are evaluated on each application (default behaviour)
+     * @param[out] strError On error: an human readable error message
+     *                      On success: undefined
+     *
+     * @return false if unable to set, true otherwise.
+     */
+    bool setDecisionTable(bool bDecisionTable, std::string &strError);
+
+    /** Would domains memorize their applicable configuration per criterion states?
+     *
+     * @return decision table policy state.
+     */
+    bool getDecisionTable() const;
+
+    /** Should identical configuration settings share their storage?
+     *
+     * Will fail if called on started instance.
+     *
+     * @param[in] bDeduplicate:
+     *     If set to true, identical area settings of all configurations are stored once after
+     *         loading or importing domains. Modified settings get their own copy.
+     *     If set to false, each configuration holds its own settings (default behaviour)
+     * @param[out] strError On error: an human readable error message
+     *                      On success: undefined
+     *
+     * @return false if unable to set, true otherwise.
+     */
+    bool setSettingsDeduplication(bool bDeduplicate, std::string &strError);
+
+    /** Would identical configuration settings share their storage?
+     *
+     * @return settings deduplication policy state.
+     */
+    bool getSettingsDeduplication() const;
+
+    /** Where should loaded settings be cached in binary format?
+     *
+     * Will fail if called on started instance.
+     *
+     * When set, configurable domains are loaded from the cache file as long as the configurable
+     * domains XML file is unchanged, skipping XML parsing and validation. Otherwise they are
+     * loaded from XML and the cache file is (re)written. Caching is disabled if the domains file
+     * includes other files.
+     *
+     * @param[in] strLocation path of the cache file, empty to disable caching (default)
+     * @param[out] strError On error: an human readable error message
+     *                      On success: undefined
+     *
+     * @return false if unable to set, true otherwise.
+     */
+    bool setSettingsCacheLocation(const std::string &strLocation, std::string &strError);
+
+    /** @return the settings cache file path, empty if caching is disabled */
+    std::string getSettingsCacheLocation() const;
+
+    /** Should subsystems be synchronized to hardware from their own thread?
+     *
+     * Will fail if called on started instance.
+     *
+     * @param[in] bAsynchronous:
+     *     If set to true, each subsystem owns a worker thread which synchronizes snapshots of
+     *         the modified settings. applyConfigurations() returns once they are posted, so that
+     *         a slow subsystem does not delay the others; use getSyncCompletion() to wait for
+     *         them. Subsystem plugins and the logger must then support being called from
+     *         these threads.
+     *     If set to false, applyConfigurations() returns once subsystems are synchronized
+     *         (default behaviour)
+     * @param[out] strError On error: an human readable error message
+     *                      On success: undefined
+     *
+     * @return false if unable to set, true otherwise.
+     */
+    bool setAsynchronousSync(bool bAsynchronous, std::string &strError);
+
+    /** Would subsystems be synchronized to hardware from their own thread?
+     *
+     * @return asynchronous synchronization policy state.
+     */
+    bool getAsynchronousSync() const;
+
+    /** Get the completion of the synchronizations of the last configuration application
+     *
+     * @return a future made ready once subsystems are synchronized with the configurations
+     *         applied so far, holding the synchronization errors, empty on success.
+     *         Invalid if not started.
+     */
+    std::shared_future<std::list<std::string>> getSyncCompletion() const;
+
 private:
     CParameterMgrPlatformConnector(const CParameterMgrPlatformConnector &);
     CParameterMgrPlatformConnector &operator=(const CParameterMgrPlatformConnector &);
     // Private logging
     void info(const std::string &log);
     void warning(const std::string &log);
+    bool isInfoEnabled() const;
+    bool isWarningEnabled() const;
 
 protected:
     // Private logging
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "parameter_export.h"
+
+#include "ElementHandle.h"
+
+#include <stdint.h>
+#include <functional>
+#include <string>
+#include <vector>
+
+/** Forward declaration of private classes.
+ * Client should not use those class.
+ * They are not part of the public api and may be remove/renamed in any release.
+ * @{
+ */
+class CParameterMgr;
+class CConfigurableElement;
+class CParameterAccessContext;
+class CParameterMgrFullConnector;
+/** @} */
+
+/** Group of element writes applied at once.
+ *
+ * Writes are first staged through the set* methods, which only check that the elements can be
+ * set, then applied all together by commit(): the blackboard is locked once, all values are
+ * written, then the elements are synchronized in a single pass. Should any write or the
+ * synchronization fail, all the written values are restored, so that neither clients nor the
+ * hardware observe a partial update.
+ *
+ * Staging rules are the ones of the matching ElementHandle setters: elements need to be rogue,
+ * array lengths need to match and byte settings need to match the element size.
+ */
+class PARAMETER_EXPORT ParameterTransaction
+{
+public:
+    /** Stage an element write.
+     *
+     * @param[in] handle the element to write, from the same Parameter Framework instance
+     * @param[in] value the value to write on commit
+     * @param[out] error On failure (false returned) will contain a human
+     *                   readable description of the error.
+     *                   On success (true returned) the content is not
+     *                   specified.
+     * @return true if the write was staged, false otherwise (see error for the detail)
+     * @{
+     */
+    bool setAsBoolean(const ElementHandle &handle, bool value, std::string &error);
+    bool setAsBooleanArray(const ElementHandle &handle, const std::vector<bool> &value,
+                           std::string &error);
+    bool setAsInteger(const ElementHandle &handle, uint32_t value, std::string &error);
+    bool setAsIntegerArray(const ElementHandle &handle, const std::vector<uint32_t> &value,
+                           std::string &error);
+    bool setAsSignedInteger(const ElementHandle &handle, int32_t value, std::string &error);
+    bool setAsSignedIntegerArray(const ElementHandle &handle, const std::vector<int32_t> &value,
+                                 std::string &error);
+    bool setAsDouble(const ElementHandle &handle, double value, std::string &error);
+    bool setAsDoubleArray(const ElementHandle &handle, const std::vector<double> &value,
+                          std::string &error);
+    bool setAsString(const ElementHandle &handle, const std::string &value, std::string &error);
+    bool setAsStringArray(const ElementHandle &handle, const std::vector<std::string> &value,
+                          std::string &error);
+    bool setAsBytes(const ElementHandle &handle, const std::vector<uint8_t> &value,
+                    std::string &error);
+    /** @} */
+
+    /** Apply all staged writes, then synchronize the written elements once.
+     *
+     * Staged writes are consumed whatever the outcome.
+     * As with ElementHandle setters, the commit is silently skipped in tuning mode.
+     * Synchronization is skipped if auto sync is off.
+     *
+     * @param[out] error On failure (false returned) will contain a human
+     *                   readable description of the error.
+     *                   On success (true returned) the content is not
+     *                   specified.
+     * @return true if all writes were applied, false if none was (see error for the detail)
+     */
+    bool commit(std::string &error);
+
+    /** Drop all staged writes. */
+    void discard();
+
+    /** @return the number of staged writes. */
+    size_t getStagedWriteCount() const;
+
+private:
+    ParameterTransaction(CParameterMgr &parameterMgr);
+    friend CParameterMgrFullConnector; // So that it can build the transaction
+
+    /** Stage a parameter write, checked as by ElementHandle setters. */
+    template <class T>
+    bool stage(const ElementHandle &handle, const T &value, std::string &error);
+
+    /** Stage a write of an element, to be applied through a blackboard access context. */
+    bool stageWrite(const ElementHandle &handle,
+                    std::function<bool(CParameterAccessContext &)> write, std::string &error);
+
+    struct Write
+    {
+        const CConfigurableElement *element;
+        std::function<bool(CParameterAccessContext &)> apply;
+    };
+
+    /** Staged writes, in order */
+    std::vector<Write> mWrites;
+
+    /** Tuning session of the first staged write, domains may only change between sessions */
+    uint64_t mTuningSession{0};
+
+    CParameterMgr &mParameterMgr;
+};
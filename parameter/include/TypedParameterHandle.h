@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "parameter_export.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+/** Forward declaration of private classes.
+ * Client should not use those class.
+ * They are not part of the public api and may be remove/renamed in any release.
+ * @{
+ */
+class CParameterMgr;
+class CBaseParameter;
+class CParameterType;
+class ISyncer;
+/** @} */
+
+/** Handle to a scalar parameter, accessed as one user type.
+ *
+ * Everything that does not depend on the value (parameter location, type adaptation and syncer)
+ * is resolved once on creation, so that successful accesses perform no heap allocation.
+ * Intended for clients accessing the same parameters at high rate, see ElementHandle for the
+ * general purpose api.
+ *
+ * Instantiated for bool, uint32_t, int32_t and double. Conversions follow the rules of the
+ * matching ElementHandle accessors (eg. setAsInteger for uint32_t).
+ *
+ * Contrary to ElementHandle, accesses directly go through the main blackboard under the
+ * blackboard mutex, blackboard snapshots are not republished on each set.
+ */
+template <class T>
+class PARAMETER_EXPORT TypedParameterHandle
+{
+public:
+    /** @return parameter's path in the parameter hierarchy tree. */
+    std::string getPath() const;
+
+    /** Set the parameter value and synchronize it.
+     *
+     * As with ElementHandle, the parameter needs to be rogue and the request is silently
+     * skipped in tuning mode.
+     *
+     * @param[in] value the value to set
+     * @param[out] error On failure (false returned) will contain a human
+     *                   readable description of the error.
+     *                   On success (true returned) the content is not
+     *                   specified.
+     * @return true if the access was successful,
+     *         false otherwise (see error for the detail)
+     */
+    bool set(T value, std::string &error);
+
+    /** Get the parameter value.
+     *
+     * @param[out] value the value to get
+     * @param[out] error On failure (false returned) will contain a human
+     *                   readable description of the error.
+     *                   On success (true returned) the content is not
+     *                   specified.
+     * @return true if the access was successful,
+     *         false otherwise (see error for the detail)
+     */
+    bool get(T &value, std::string &error) const;
+
+private:
+    TypedParameterHandle(const CBaseParameter &parameter, CParameterMgr &parameterMgr);
+    friend CParameterMgr; // So that it can build the handler
+
+    /** @return true if the parameter is rogue, cached as long as domains may not change. */
+    bool isRogue();
+
+    const CBaseParameter &mParameter;
+
+    CParameterMgr &mParameterMgr;
+
+    /** Type adaptation of the parameter.
+     * nullptr if it is not stored as an integer (eg. bit parameters), in which case accesses
+     * are delegated to the parameter.
+     */
+    const CParameterType *mType;
+
+    /** Parameter location in the main blackboard. @{ */
+    size_t mOffset;
+    size_t mSize;
+    /** @} */
+
+    /** Syncer of the parameter, nullptr if none. */
+    ISyncer *mSyncer;
+
+    /** Rogue status cache, valid for the tuning session it was computed in. @{ */
+    bool mRogue{false};
+    uint64_t mRogueTuningSession{~uint64_t(0)};
+    /** @} */
+};
@@ -44,10 +44,12 @@ public:
     /**
      * Class Constructor
      *
+     * @tparam T string or string literal, the latter is not copied if info logs are disabled
      * @param[in] logger application logger
      * @param[in] context name of the context to open
      */
-    Context(Logger &logger, const std::string &context) : mLogger(logger)
+    template <class T>
+    Context(Logger &logger, const T &context) : mLogger(logger)
     {
         mLogger.info() << context << " {";
         mLogger.mProlog += "    ";
@@ -43,6 +43,13 @@ public:
     virtual void info(const std::string &strLog) = 0;
     virtual void warning(const std::string &strLog) = 0;
 
+    /** Whether logs of a level are output at all
+     *
+     * Logs of a disabled level are neither formatted nor forwarded.
+     */
+    virtual bool isInfoEnabled() const { return true; }
+    virtual bool isWarningEnabled() const { return true; }
+
 protected:
     virtual ~ILogger() {}
 };
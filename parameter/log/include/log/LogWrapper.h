@@ -35,6 +35,7 @@
 #include <sstream>
 #include <iterator>
 #include <list>
+#include <memory>
 
 namespace core
 {
@@ -46,6 +47,7 @@ namespace details
 /**
  * Template log wrapper
  * Simulate a stream which can be used instead of basic ILogger API.
+ * Nothing is formatted if the log level is disabled by the ILogger.
  *
  * @tparam isWarning indicates which log canal to use
  */
@@ -54,7 +56,9 @@ class LogWrapper
 {
 public:
     /** @param logger the ILogger to wrap */
-    LogWrapper(ILogger &logger, const std::string &prolog = "") : mLogger(logger), mProlog(prolog)
+    LogWrapper(ILogger &logger, const std::string &prolog = "")
+        : mLogger(logger), mProlog(prolog),
+          mEnabled(isWarning ? logger.isWarningEnabled() : logger.isInfoEnabled())
     {
     }
 
@@ -64,18 +68,23 @@ public:
      * @param[in] logWrapper the instance to copy
      */
     LogWrapper(const LogWrapper &logWrapper)
-        : mLogger(logWrapper.mLogger), mProlog(logWrapper.mProlog)
+        : mLogger(logWrapper.mLogger), mProlog(logWrapper.mProlog), mEnabled(logWrapper.mEnabled)
     {
     }
 
     /** Class destructor */
     ~LogWrapper()
     {
-        if (!mLog.str().empty()) {
+        if (mLog == nullptr) {
+            return;
+        }
+        std::string log = mLog->str();
+
+        if (!log.empty()) {
             if (isWarning) {
-                mLogger.warning(mProlog + mLog.str());
+                mLogger.warning(mProlog + log);
             } else {
-                mLogger.info(mProlog + mLog.str());
+                mLogger.info(mProlog + log);
             }
         }
     }
@@ -89,7 +98,9 @@ public:
     template <class T>
     LogWrapper &operator<<(const T &log)
     {
-        mLog << log;
+        if (mEnabled) {
+            stream() << log;
+        }
         return *this;
     }
 
@@ -100,11 +111,15 @@ public:
      */
     LogWrapper &operator<<(const std::list<std::string> &logs)
     {
+        if (!mEnabled) {
+            return *this;
+        }
         std::string separator = "\n" + mProlog;
         std::string formatedLogs = utility::asString(logs, separator);
+        std::string log = stream().str();
 
         // Check if there is something in the log to know if we have to add a prefix
-        if (!mLog.str().empty() && mLog.str()[mLog.str().length() - 1] == separator[0]) {
+        if (!log.empty() && log[log.length() - 1] == separator[0]) {
             *this << mProlog;
         }
 
@@ -115,14 +130,26 @@ public:
 private:
     LogWrapper &operator=(const LogWrapper &);
 
+    /** Log stream, created by the first enabled log */
+    std::ostringstream &stream()
+    {
+        if (mLog == nullptr) {
+            mLog.reset(new std::ostringstream);
+        }
+        return *mLog;
+    }
+
     /** Log stream holder */
-    std::ostringstream mLog;
+    std::unique_ptr<std::ostringstream> mLog;
 
     /** Wrapped logger */
     ILogger &mLogger;
 
     /** Log Prefix */
     const std::string &mProlog;
+
+    /** Whether the log level is enabled by the wrapped logger */
+    const bool mEnabled;
 };
 
 /** Default information logger type */
@@ -68,6 +68,16 @@ public:
      */
     details::Warning warning() { return details::Warning(mLogger, mProlog); }
 
+    /** Whether info logs are enabled
+     *
+     * Info logs are not formatted when disabled, but their operands are still evaluated:
+     * check this first if they are costly to compute.
+     */
+    bool isInfoEnabled() const { return mLogger.isInfoEnabled(); }
+
+    /** Whether warning logs are enabled, @see isInfoEnabled */
+    bool isWarningEnabled() const { return mLogger.isWarningEnabled(); }
+
 private:
     /** Raw logger provided by client */
     ILogger &mLogger;
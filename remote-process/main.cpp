@@ -33,14 +33,19 @@
 #include <iostream>
 #include <string>
 #include <cstring>
+#include <vector>
 #include <stdlib.h>
 #include "RequestMessage.h"
 #include "AnswerMessage.h"
+#include "BatchRequestMessage.h"
+#include "BatchAnswerMessage.h"
 #include "Socket.h"
+#include "Tokenizer.h"
 
 using namespace std;
 
-bool sendAndDisplayCommand(asio::ip::tcp::socket &socket, CRequestMessage &requestMessage)
+bool sendAndDisplayCommand(asio::generic::stream_protocol::socket &socket,
+                           CRequestMessage &requestMessage)
 {
     string strError;
 
@@ -72,41 +77,172 @@ bool sendAndDisplayCommand(asio::ip::tcp::socket &socket, CRequestMessage &reque
     return true;
 }
 
+// Display the answers to a batch of commands
+// Return false on communication failure, bAllSucceeded telling if every command succeeded
+bool sendAndDisplayBatch(asio::generic::stream_protocol::socket &socket,
+                         CBatchRequestMessage &batchRequestMessage, bool &bAllSucceeded)
+{
+    string strError;
+
+    if (batchRequestMessage.serialize(Socket(socket), true, strError) !=
+        CRequestMessage::success) {
+
+        cerr << "Unable to send commands to target: " << strError << endl;
+        return false;
+    }
+
+    ///// Get answers
+    CBatchAnswerMessage batchAnswerMessage;
+    if (batchAnswerMessage.serialize(Socket(socket), false, strError) !=
+        CRequestMessage::success) {
+
+        cerr << "Unable to received answers from target: " << strError << endl;
+        return false;
+    }
+
+    for (size_t answer = 0; answer < batchAnswerMessage.getAnswerCount(); answer++) {
+
+        if (!batchAnswerMessage.success(answer)) {
+
+            cerr << batchAnswerMessage.getAnswer(answer) << endl;
+            bAllSucceeded = false;
+            continue;
+        }
+        cout << batchAnswerMessage.getAnswer(answer) << endl;
+    }
+
+    if (batchAnswerMessage.getAnswerCount() != batchRequestMessage.getCommandCount()) {
+
+        cerr << "Target answered " << batchAnswerMessage.getAnswerCount() << " out of "
+             << batchRequestMessage.getCommandCount() << " commands" << endl;
+        return false;
+    }
+    return true;
+}
+
+// Send commands read from standard input, one per line, by batches to save round trips
+bool sendAndDisplayCommands(asio::generic::stream_protocol::socket &socket)
+{
+    // Commands sent at once, bounding the size of messages
+    const size_t batchSize = 1000;
+
+    bool bAllSucceeded = true;
+    string strLine;
+
+    while (cin) {
+
+        CBatchRequestMessage batchRequestMessage;
+
+        while (batchRequestMessage.getCommandCount() < batchSize && getline(cin, strLine)) {
+
+            vector<string> tokens = Tokenizer(strLine).split();
+
+            // Skip blank lines
+            if (tokens.empty()) {
+                continue;
+            }
+
+            CRequestMessage &requestMessage = batchRequestMessage.addCommand(tokens.front());
+
+            for (auto token = tokens.begin() + 1; token != tokens.end(); ++token) {
+
+                requestMessage.addArgument(*token);
+            }
+        }
+
+        if (batchRequestMessage.getCommandCount() != 0 &&
+            !sendAndDisplayBatch(socket, batchRequestMessage, bAllSucceeded)) {
+            return false;
+        }
+    }
+    return bAllSucceeded;
+}
+
+// Connect to a TCP host and port, trying each address the host resolves to
+asio::error_code connectTcp(asio::io_service &io_service,
+                            asio::generic::stream_protocol::socket &socket, const string &host,
+                            const string &port)
+{
+    using asio::ip::tcp;
+    tcp::resolver resolver(io_service);
+
+    asio::error_code ec;
+    auto endpoint = resolver.resolve(tcp::resolver::query(host, port), ec);
+
+    if (!ec) {
+        ec = asio::error::host_not_found;
+    }
+    for (; ec && endpoint != tcp::resolver::iterator(); ++endpoint) {
+
+        socket.close(ec);
+        socket.connect(endpoint->endpoint(), ec);
+    }
+    return ec;
+}
+
 // hostname port command [argument[s]]
 // or
 // hostname port < commands
+// or the same with unix:<socket path> in place of hostname port
 int main(int argc, char *argv[])
 {
+    // Either a Unix domain socket, or a TCP host and port
+    const string unixPrefix = "unix:";
+    bool bUnix = argc > 1 && string(argv[1]).compare(0, unixPrefix.size(), unixPrefix) == 0;
+    int commandArg = bUnix ? 2 : 3;
+
     // Enough args?
-    if (argc < 4) {
+    if (argc < commandArg) {
 
         cerr << "Missing arguments" << endl;
         cerr << "Usage: " << endl;
         cerr << "Send a single command:" << endl;
         cerr << "\t" << argv[0] << " hostname port command [argument[s]]" << endl;
+        cerr << "Send commands read from standard input, one per line:" << endl;
+        cerr << "\t" << argv[0] << " hostname port < commands" << endl;
+        cerr << "Unix domain sockets are reached with unix:<socket path> in place of"
+                " hostname port"
+             << endl;
 
         return 1;
     }
-    using asio::ip::tcp;
     asio::io_service io_service;
-    tcp::resolver resolver(io_service);
+    asio::generic::stream_protocol::socket connectionSocket(io_service);
 
-    tcp::socket connectionSocket(io_service);
+    string address;
+    asio::error_code ec;
 
-    string host{argv[1]};
-    string port{argv[2]};
-    try {
-        asio::connect(connectionSocket, resolver.resolve(tcp::resolver::query(host, port)));
-    } catch (const asio::system_error &e) {
-        cerr << "Connection to '" << host << ":" << port << "' failed: " << e.what() << endl;
+    if (bUnix) {
+
+        string path = string(argv[1]).substr(unixPrefix.size());
+        address = path;
+#ifdef ASIO_HAS_LOCAL_SOCKETS
+        connectionSocket.connect(asio::local::stream_protocol::endpoint(path), ec);
+#else
+        ec = asio::error::operation_not_supported;
+#endif
+    } else {
+
+        string host{argv[1]};
+        string port{argv[2]};
+        address = host + ":" + port;
+        ec = connectTcp(io_service, connectionSocket, host, port);
+    }
+    if (ec) {
+        cerr << "Connection to '" << address << "' failed: " << ec.message() << endl;
         return 1;
     }
 
+    if (argc == commandArg) {
+
+        return sendAndDisplayCommands(connectionSocket) ? 0 : 1;
+    }
+
     // Create command message
-    CRequestMessage requestMessage(argv[3]);
+    CRequestMessage requestMessage(argv[commandArg]);
 
     // Add arguments
-    for (int arg = 4; arg < argc; arg++) {
+    for (int arg = commandArg + 1; arg < argc; arg++) {
 
         requestMessage.addArgument(argv[arg]);
     }
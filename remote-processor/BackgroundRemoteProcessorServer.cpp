@@ -36,6 +36,13 @@ BackgroundRemoteProcessorServer::BackgroundRemoteProcessorServer(
 {
 }
 
+BackgroundRemoteProcessorServer::BackgroundRemoteProcessorServer(
+    const std::string &strSocketPath, std::unique_ptr<IRemoteCommandHandler> &&commandHandler)
+    : _server(new CRemoteProcessorServer(strSocketPath)),
+      mCommandHandler(std::move(commandHandler))
+{
+}
+
 bool BackgroundRemoteProcessorServer::start(std::string &error)
 {
     if (!_server->start(error)) {
@@ -43,6 +43,10 @@ public:
     BackgroundRemoteProcessorServer(uint16_t uiPort,
                                     std::unique_ptr<IRemoteCommandHandler> &&commandHandler);
 
+    /** Listen on a Unix domain socket instead of a TCP port */
+    BackgroundRemoteProcessorServer(const std::string &strSocketPath,
+                                    std::unique_ptr<IRemoteCommandHandler> &&commandHandler);
+
     ~BackgroundRemoteProcessorServer() override;
 
     bool start(std::string &error) override;
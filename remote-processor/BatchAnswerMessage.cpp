@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "BatchAnswerMessage.h"
+#include <assert.h>
+
+#define base CMessage
+
+using std::string;
+
+CBatchAnswerMessage::CBatchAnswerMessage() : base(MsgType::EBatchAnswer)
+{
+}
+
+void CBatchAnswerMessage::addAnswer(const string &strAnswer, bool bSuccess)
+{
+    _answers.push_back({strAnswer, bSuccess});
+}
+
+size_t CBatchAnswerMessage::getAnswerCount() const
+{
+    return _answers.size();
+}
+
+const string &CBatchAnswerMessage::getAnswer(size_t answer) const
+{
+    assert(answer < _answers.size());
+
+    return _answers[answer].strAnswer;
+}
+
+bool CBatchAnswerMessage::success(size_t answer) const
+{
+    assert(answer < _answers.size());
+
+    return _answers[answer].bSuccess;
+}
+
+// Fill data to send
+void CBatchAnswerMessage::fillDataToSend()
+{
+    uint32_t answerCount = static_cast<uint32_t>(getAnswerCount());
+
+    writeData(&answerCount, sizeof(answerCount));
+
+    for (const auto &answer : _answers) {
+
+        uint8_t success = answer.bSuccess;
+
+        writeData(&success, sizeof(success));
+
+        writeString(answer.strAnswer);
+    }
+}
+
+// Collect received data
+void CBatchAnswerMessage::collectReceivedData()
+{
+    _answers.clear();
+
+    // Not a batch answer, e.g. a peer not supporting batches, take it as a single answer
+    if (getMsgId() != MsgType::EBatchAnswer) {
+
+        string strAnswer;
+
+        readString(strAnswer);
+
+        addAnswer(strAnswer, getMsgId() == MsgType::ESuccessAnswer);
+        return;
+    }
+
+    uint32_t answerCount;
+
+    readData(&answerCount, sizeof(answerCount));
+
+    for (uint32_t answer = 0; answer < answerCount; answer++) {
+
+        uint8_t success;
+
+        readData(&success, sizeof(success));
+
+        string strAnswer;
+
+        readString(strAnswer);
+
+        addAnswer(strAnswer, success != 0);
+    }
+}
+
+// Size
+size_t CBatchAnswerMessage::getDataSize() const
+{
+    // Answer count
+    size_t size = sizeof(uint32_t);
+
+    for (const auto &answer : _answers) {
+
+        // Status and answer
+        size += sizeof(uint8_t) + getStringSize(answer.strAnswer);
+    }
+    return size;
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "remote_processor_export.h"
+
+#include "Message.h"
+#include <string>
+#include <vector>
+
+/** Answers to the commands of a CBatchRequestMessage, in the same order */
+class REMOTE_PROCESSOR_EXPORT CBatchAnswerMessage : public CMessage
+{
+public:
+    CBatchAnswerMessage();
+
+    /** Append the answer to the next command of the batch */
+    void addAnswer(const std::string &strAnswer, bool bSuccess);
+
+    size_t getAnswerCount() const;
+
+    // Answer
+    const std::string &getAnswer(size_t answer) const;
+
+    // Status
+    bool success(size_t answer) const;
+
+private:
+    // Fill data to send
+    void fillDataToSend() override;
+    // Collect received data
+    void collectReceivedData() override;
+
+    /** @return size of the batch answer message in bytes
+     */
+    size_t getDataSize() const override;
+
+    struct Answer
+    {
+        std::string strAnswer;
+        bool bSuccess;
+    };
+    std::vector<Answer> _answers;
+};
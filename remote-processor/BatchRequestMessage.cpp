@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "BatchRequestMessage.h"
+#include <assert.h>
+
+#define base CMessage
+
+using std::string;
+
+CBatchRequestMessage::CBatchRequestMessage() : base(MsgType::EBatchRequest)
+{
+}
+
+CRequestMessage &CBatchRequestMessage::addCommand(const string &strCommand)
+{
+    _commands.emplace_back(new CRequestMessage(strCommand));
+
+    return *_commands.back();
+}
+
+size_t CBatchRequestMessage::getCommandCount() const
+{
+    return _commands.size();
+}
+
+const CRequestMessage &CBatchRequestMessage::getCommand(size_t command) const
+{
+    assert(command < _commands.size());
+
+    return *_commands[command];
+}
+
+// Fill data to send
+void CBatchRequestMessage::fillDataToSend()
+{
+    uint32_t commandCount = static_cast<uint32_t>(getCommandCount());
+
+    writeData(&commandCount, sizeof(commandCount));
+
+    for (const auto &command : _commands) {
+
+        // Command name and arguments
+        uint32_t stringCount = static_cast<uint32_t>(1 + command->getArgumentCount());
+
+        writeData(&stringCount, sizeof(stringCount));
+
+        writeString(command->getCommand());
+
+        for (const auto &strArgument : command->getArguments()) {
+
+            writeString(strArgument);
+        }
+    }
+}
+
+// Collect received data
+void CBatchRequestMessage::collectReceivedData()
+{
+    uint32_t commandCount;
+
+    readData(&commandCount, sizeof(commandCount));
+
+    _commands.clear();
+
+    for (uint32_t command = 0; command < commandCount; command++) {
+
+        uint32_t stringCount;
+
+        readData(&stringCount, sizeof(stringCount));
+
+        // Command name
+        string strCommand;
+
+        readString(strCommand);
+
+        CRequestMessage &requestMessage = addCommand("");
+        requestMessage.setCommand(strCommand);
+
+        // Arguments
+        for (uint32_t argument = 1; argument < stringCount; argument++) {
+
+            string strArgument;
+
+            readString(strArgument);
+
+            requestMessage.addArgument(strArgument);
+        }
+    }
+}
+
+// Size
+size_t CBatchRequestMessage::getDataSize() const
+{
+    // Command count
+    size_t size = sizeof(uint32_t);
+
+    for (const auto &command : _commands) {
+
+        // String count, command name and arguments
+        size += sizeof(uint32_t) + getStringSize(command->getCommand());
+
+        for (const auto &strArgument : command->getArguments()) {
+
+            size += getStringSize(strArgument);
+        }
+    }
+    return size;
+}
@@ -31,6 +31,7 @@
 #include "Socket.h"
 #include "Iterator.hpp"
 #include <asio.hpp>
+#include <algorithm>
 #include <vector>
 #include <numeric>
 #include <cassert>
@@ -129,127 +130,141 @@ size_t CMessage::getRemainingDataSize() const
 // Send/Receive
 CMessage::Result CMessage::serialize(Socket &&socket, bool bOut, string &strError)
 {
-    asio::ip::tcp::socket &asioSocket = socket.get();
+    asio::generic::stream_protocol::socket &asioSocket = socket.get();
+    asio::error_code ec;
 
     if (bOut) {
-        asio::error_code ec;
 
-        // Make room for data to send
-        allocateData(getDataSize());
-
-        // Get data from derived
-        fillDataToSend();
-
-        // Finished providing data?
-        assert(_uiIndex == getMessageDataSize());
-
-        // First send sync word
-        uint16_t uiSyncWord = SYNC_WORD;
-
-        if (!asio::write(asioSocket, asio::buffer(&uiSyncWord, sizeof(uiSyncWord)), ec)) {
+        // Whole frame in a single write
+        if (!asio::write(asioSocket, asio::buffer(buildFrame()), ec)) {
 
             if (ec == asio::error::eof) {
                 return peerDisconnected;
             }
+            strError = string("Frame write failed: ") + ec.message();
             return error;
         }
+    } else {
+        // First read sync word and size
+        std::vector<uint8_t> header(headerSize);
 
-        // Size
-        uint32_t uiSize = (uint32_t)(sizeof(_ucMsgId) + getMessageDataSize());
+        if (!asio::read(asioSocket, asio::buffer(header), ec)) {
+            strError = string("Header read failed: ") + ec.message();
+            if (ec == asio::error::eof) {
+                return peerDisconnected;
+            }
+            return error;
+        }
 
-        if (!asio::write(asioSocket, asio::buffer(&uiSize, sizeof(uiSize)), ec)) {
+        size_t remainingSize;
 
-            strError += string("Size write failed: ") + ec.message();
+        if (!checkFrameHeader(header, remainingSize, strError)) {
             return error;
         }
 
-        // Msg Id
-        if (!asio::write(asioSocket, asio::buffer(&_ucMsgId, sizeof(_ucMsgId)), ec)) {
+        // Msg Id, data and checksum
+        std::vector<uint8_t> frame(remainingSize);
 
-            strError += string("Msg write failed: ") + ec.message();
+        if (!asio::read(asioSocket, asio::buffer(frame), ec)) {
+            strError = string("Frame read failed: ") + ec.message();
             return error;
         }
 
-        // Data
-        if (!asio::write(asioSocket, asio::buffer(mData), ec)) {
-
-            strError = string("Data write failed: ") + ec.message();
+        if (!collectFrame(frame, strError)) {
             return error;
         }
+    }
+
+    return success;
+}
 
-        // Checksum
-        uint8_t ucChecksum = computeChecksum();
+std::vector<uint8_t> CMessage::buildFrame()
+{
+    // Make room for data to send
+    allocateData(getDataSize());
 
-        if (!asio::write(asioSocket, asio::buffer(&ucChecksum, sizeof(ucChecksum)), ec)) {
+    // Get data from derived
+    fillDataToSend();
 
-            strError = string("Checksum write failed: ") + ec.message();
-            return error;
-        }
+    // Finished providing data?
+    assert(_uiIndex == getMessageDataSize());
 
-    } else {
-        // First read sync word
-        uint16_t uiSyncWord = 0;
-        asio::error_code ec;
+    uint16_t uiSyncWord = SYNC_WORD;
+    uint32_t uiSize = (uint32_t)(sizeof(_ucMsgId) + getMessageDataSize());
+    uint8_t ucChecksum = computeChecksum();
 
-        if (!asio::read(asioSocket, asio::buffer(&uiSyncWord, sizeof(uiSyncWord)), ec)) {
-            strError = string("Sync read failed: ") + ec.message();
-            if (ec == asio::error::eof) {
-                return peerDisconnected;
-            }
-            return error;
-        }
+    std::vector<uint8_t> frame(headerSize + uiSize + sizeof(ucChecksum));
+    auto it = begin(frame);
 
-        // Check Sync word
-        if (uiSyncWord != SYNC_WORD) {
+    // Sync word, size, msg id, data then checksum
+    it = std::copy_n(reinterpret_cast<const uint8_t *>(&uiSyncWord), sizeof(uiSyncWord), it);
+    it = std::copy_n(reinterpret_cast<const uint8_t *>(&uiSize), sizeof(uiSize), it);
+    it = std::copy_n(reinterpret_cast<const uint8_t *>(&_ucMsgId), sizeof(_ucMsgId), it);
+    it = std::copy(begin(mData), end(mData), it);
+    *it = ucChecksum;
 
-            strError = "Sync word incorrect";
-            return error;
-        }
+    return frame;
+}
 
-        // Size
-        uint32_t uiSize = 0;
+bool CMessage::checkFrameHeader(const std::vector<uint8_t> &header, size_t &remainingSize,
+                                string &strError)
+{
+    assert(header.size() == headerSize);
 
-        if (!asio::read(asioSocket, asio::buffer(&uiSize, sizeof(uiSize)), ec)) {
-            strError = string("Size read failed: ") + ec.message();
-            return error;
-        }
+    uint16_t uiSyncWord;
+    uint32_t uiSize;
 
-        // Msg Id
-        if (!asio::read(asioSocket, asio::buffer(&_ucMsgId, sizeof(_ucMsgId)), ec)) {
-            strError = string("Msg id read failed: ") + ec.message();
-            return error;
-        }
+    std::copy_n(begin(header), sizeof(uiSyncWord), reinterpret_cast<uint8_t *>(&uiSyncWord));
+    std::copy_n(begin(header) + sizeof(uiSyncWord), sizeof(uiSize),
+                reinterpret_cast<uint8_t *>(&uiSize));
 
-        // Data
+    // Check Sync word
+    if (uiSyncWord != SYNC_WORD) {
 
-        // Allocate
-        allocateData(uiSize - sizeof(_ucMsgId));
+        strError = "Sync word incorrect";
+        return false;
+    }
+    // Size covers at least the msg id
+    if (uiSize < sizeof(MsgType)) {
 
-        // Data receive
-        if (!asio::read(asioSocket, asio::buffer(mData), ec)) {
-            strError = string("Data read failed: ") + ec.message();
-            return error;
-        }
+        strError = "Size incorrect";
+        return false;
+    }
+    // Followed by the checksum
+    remainingSize = uiSize + sizeof(uint8_t);
 
-        // Checksum
-        uint8_t ucChecksum = 0;
+    return true;
+}
 
-        if (!asio::read(asioSocket, asio::buffer(&ucChecksum, sizeof(ucChecksum)), ec)) {
-            strError = string("Checksum read failed: ") + ec.message();
-            return error;
-        }
-        // Compare
-        if (ucChecksum != computeChecksum()) {
+CMessage::MsgType CMessage::peekMsgId(const std::vector<uint8_t> &frame)
+{
+    assert(not frame.empty());
 
-            strError = "Received checksum != computed checksum";
-            return error;
-        }
+    return static_cast<MsgType>(frame.front());
+}
+
+bool CMessage::collectFrame(const std::vector<uint8_t> &frame, string &strError)
+{
+    assert(frame.size() >= sizeof(_ucMsgId) + sizeof(uint8_t));
 
-        // Collect data in derived
-        collectReceivedData();
+    // Msg Id
+    _ucMsgId = static_cast<MsgType>(frame.front());
+
+    // Data
+    allocateData(frame.size() - sizeof(_ucMsgId) - sizeof(uint8_t));
+    std::copy(begin(frame) + sizeof(_ucMsgId), end(frame) - 1, begin(mData));
+
+    // Compare checksum
+    if (frame.back() != computeChecksum()) {
+
+        strError = "Received checksum != computed checksum";
+        return false;
     }
 
-    return success;
+    // Collect data in derived
+    collectReceivedData();
+
+    return true;
 }
 
 // Checksum
@@ -46,6 +46,8 @@ public:
         ECommandRequest,
         ESuccessAnswer,
         EFailureAnswer,
+        EBatchRequest,
+        EBatchAnswer,
         EInvalid = static_cast<uint8_t>(-1),
     };
     CMessage(MsgType ucMsgId);
@@ -73,6 +75,46 @@ public:
      */
     Result serialize(Socket &&socket, bool bOut, std::string &strError);
 
+    /** Size of the frame header, i.e. the sync word and the size of the rest of the frame */
+    static const size_t headerSize = sizeof(uint16_t) + sizeof(uint32_t);
+
+    /** Build the frame conveying the message, for asynchronous writes
+     *
+     * @return the bytes to write, header included
+     */
+    std::vector<uint8_t> buildFrame();
+
+    /** Check a received frame header, for asynchronous reads
+     *
+     * @param[in] header the headerSize first bytes of the frame
+     * @param[out] remainingSize size of the rest of the frame, to be read and given to
+     *                           collectFrame
+     * @param[out] strError on failure, a string explaining the error,
+     *                      on success, undefined.
+     *
+     * @return true if the header is correct, false otherwise
+     */
+    static bool checkFrameHeader(const std::vector<uint8_t> &header, size_t &remainingSize,
+                                 std::string &strError);
+
+    /** Collect the message from the rest of a received frame, for asynchronous reads
+     *
+     * @param[in] frame the frame bytes following the header
+     * @param[out] strError on failure, a string explaining the error,
+     *                      on success, undefined.
+     *
+     * @return true if the message could be collected, false otherwise
+     */
+    bool collectFrame(const std::vector<uint8_t> &frame, std::string &strError);
+
+    /** Tell the kind of message a received frame conveys, before collecting it
+     *
+     * @param[in] frame the frame bytes following the header
+     *
+     * @return the message id of the frame
+     */
+    static MsgType peekMsgId(const std::vector<uint8_t> &frame);
+
 protected:
     // Msg Id
     MsgType getMsgId() const;
@@ -29,8 +29,11 @@
  */
 #pragma once
 
+#include <algorithm>
+#include <mutex>
 #include <vector>
 #include "RemoteCommandHandler.h"
+#include "SharedMutex.hpp"
 
 template <class CCommandParser>
 class TRemoteCommandHandlerTemplate : public IRemoteCommandHandler
@@ -62,10 +65,10 @@ private:
     public:
         CRemoteCommandParserItem(const std::string &strCommandName, RemoteCommandParser pfnParser,
                                  size_t minArgumentCount, const std::string &strHelp,
-                                 const std::string &strDescription)
+                                 const std::string &strDescription, bool bReadOnly)
             : _strCommandName(strCommandName), _pfnParser(pfnParser),
               _minArgumentCount(minArgumentCount), _strHelp(strHelp),
-              _strDescription(strDescription)
+              _strDescription(strDescription), _bReadOnly(bReadOnly)
         {
         }
 
@@ -73,6 +76,8 @@ private:
 
         const std::string &getDescription() const { return _strDescription; }
 
+        bool isReadOnly() const { return _bReadOnly; }
+
         // Usage
         std::string usage() const { return _strCommandName + " " + _strHelp; }
 
@@ -109,6 +114,7 @@ private:
         size_t _minArgumentCount;
         std::string _strHelp;
         std::string _strDescription;
+        bool _bReadOnly;
     };
 
 public:
@@ -127,10 +133,18 @@ public:
         }
     }
 
-    // Parsers
+    /** Add a command parser
+     *
+     * Commands may be processed from several threads. Read-only commands run concurrently with
+     * each other, any other command runs alone.
+     *
+     * @param[in] bReadOnly true if the parser leaves the command parser state untouched
+     *
+     * @return false if a command of the same name already exists, true otherwise
+     */
     bool addCommandParser(const std::string &strCommandName, RemoteCommandParser pfnParser,
                           size_t minArgumentCount, const std::string &strHelp,
-                          const std::string &strDescription)
+                          const std::string &strDescription, bool bReadOnly = false)
     {
         if (findCommandParserItem(strCommandName)) {
 
@@ -140,7 +154,11 @@ public:
 
         // Add command
         _remoteCommandParserVector.push_back(new CRemoteCommandParserItem(
-            strCommandName, pfnParser, minArgumentCount, strHelp, strDescription));
+            strCommandName, pfnParser, minArgumentCount, strHelp, strDescription, bReadOnly));
+
+        // Max command usage length, use for formatting
+        _maxCommandUsageLength =
+            std::max(_maxCommandUsageLength, _remoteCommandParserVector.back()->usage().length());
 
         return true;
     }
@@ -168,32 +186,22 @@ private:
             return true;
         }
 
-        return pRemoteCommandParserItem->parse(_pCommandParser, remoteCommand, strResult);
-    }
+        if (pRemoteCommandParserItem->isReadOnly()) {
 
-    // Max command usage length, use for formatting
-    void initMaxCommandUsageLength()
-    {
-        if (!_maxCommandUsageLength) {
-            // Show usages
-            for (const auto *pRemoteCommandParserItem : _remoteCommandParserVector) {
+            utility::SharedLock lock(_commandMutex);
 
-                size_t remoteCommandUsageLength = pRemoteCommandParserItem->usage().length();
+            return pRemoteCommandParserItem->parse(_pCommandParser, remoteCommand, strResult);
+        }
 
-                if (remoteCommandUsageLength > _maxCommandUsageLength) {
+        std::lock_guard<utility::SharedMutex> lock(_commandMutex);
 
-                    _maxCommandUsageLength = remoteCommandUsageLength;
-                }
-            }
-        }
+        return pRemoteCommandParserItem->parse(_pCommandParser, remoteCommand, strResult);
     }
 
     /////////////////// Remote command parsers
     /// Help
     void helpCommandProcess(std::string &strResult)
     {
-        initMaxCommandUsageLength();
-
         // Show usages
         for (const auto *pRemoteCommandParserItem : _remoteCommandParserVector) {
 
@@ -223,4 +231,7 @@ private:
     CCommandParser *_pCommandParser;
     std::vector<CRemoteCommandParserItem *> _remoteCommandParserVector;
     size_t _maxCommandUsageLength;
+
+    /** Held shared by read-only commands, exclusively by the others */
+    utility::SharedMutex _commandMutex;
 };
@@ -28,19 +28,69 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 #include "RemoteProcessorServer.h"
+#include "RemoteProcessorSession.h"
+#include <cstdio>
 #include <iostream>
 #include <memory>
-#include <assert.h>
-#include <string.h>
-#include "RequestMessage.h"
-#include "AnswerMessage.h"
-#include "RemoteCommandHandler.h"
-#include "Socket.h"
+#include <thread>
+#include <vector>
+#include <sys/stat.h>
 
 using std::string;
 
+#ifdef ASIO_HAS_LOCAL_SOCKETS
+/** Remove the socket left at a path by an instance which did not stop cleanly
+ *
+ * Anything else is left untouched: a file which is not a socket, or the socket of an instance
+ * still accepting connections.
+ *
+ * @param[in] io_service the service to probe the socket with
+ * @param[in] path the path to bind to
+ * @param[out] error human readable error, in case of failure
+ * @return true if nothing prevents binding to the path any more, false otherwise
+ */
+static bool removeStaleSocket(asio::io_service &io_service, const string &path, string &error)
+{
+    struct stat status;
+
+    if (stat(path.c_str(), &status) != 0) {
+
+        // Nothing to remove, binding reports any other issue
+        return true;
+    }
+    if (!S_ISSOCK(status.st_mode)) {
+
+        error = "Not a socket";
+        return false;
+    }
+
+    // Only a socket nobody listens on any more is stale
+    asio::local::stream_protocol::socket probe(io_service);
+    asio::error_code ec;
+
+    probe.connect(asio::local::stream_protocol::endpoint(path), ec);
+
+    if (ec != asio::error::connection_refused) {
+
+        error = ec ? ec.message() : "Address already in use";
+        return false;
+    }
+    if (std::remove(path.c_str()) != 0) {
+
+        error = "Unable to remove stale socket";
+        return false;
+    }
+    return true;
+}
+#endif
+
 CRemoteProcessorServer::CRemoteProcessorServer(uint16_t uiPort)
-    : _uiPort(uiPort), _io_service(), _acceptor(_io_service), _socket(_io_service)
+    : _uiPort(uiPort), _io_service(), _acceptor(_io_service)
+{
+}
+
+CRemoteProcessorServer::CRemoteProcessorServer(const string &strSocketPath)
+    : _strSocketPath(strSocketPath), _io_service(), _acceptor(_io_service)
 {
 }
 
@@ -55,7 +105,27 @@ bool CRemoteProcessorServer::start(string &error)
     using namespace asio;
 
     try {
-        ip::tcp::endpoint endpoint(ip::tcp::v6(), _uiPort);
+        generic::stream_protocol::endpoint endpoint;
+
+        if (_strSocketPath.empty()) {
+
+            endpoint = ip::tcp::endpoint(ip::tcp::v6(), _uiPort);
+        } else {
+#ifdef ASIO_HAS_LOCAL_SOCKETS
+            // A socket left by a previous instance would prevent binding
+            string strRemoveError;
+            if (!removeStaleSocket(_io_service, _strSocketPath, strRemoveError)) {
+
+                error = "Unable to listen on " + getAddress() + ": " + strRemoveError;
+                return false;
+            }
+
+            endpoint = local::stream_protocol::endpoint(_strSocketPath);
+#else
+            error = "Unable to listen on " + getAddress() + ": Unix domain sockets unsupported";
+            return false;
+#endif
+        }
 
         _acceptor.open(endpoint.protocol());
 
@@ -66,13 +136,19 @@ bool CRemoteProcessorServer::start(string &error)
         _acceptor.bind(endpoint);
         _acceptor.listen();
     } catch (std::exception &e) {
-        error = "Unable to listen on port " + std::to_string(_uiPort) + ": " + e.what();
+        error = "Unable to listen on " + getAddress() + ": " + e.what();
         return false;
     }
 
     return true;
 }
 
+string CRemoteProcessorServer::getAddress() const
+{
+    return _strSocketPath.empty() ? "port " + std::to_string(_uiPort)
+                                  : "socket " + _strSocketPath;
+}
+
 bool CRemoteProcessorServer::stop()
 {
     _io_service.stop();
@@ -82,87 +158,50 @@ bool CRemoteProcessorServer::stop()
 
 void CRemoteProcessorServer::acceptRegister(IRemoteCommandHandler &commandHandler)
 {
-    auto peerHandler = [this, &commandHandler](asio::error_code ec) {
+    auto session = std::make_shared<CRemoteProcessorSession>(_io_service, commandHandler);
+
+    auto peerHandler = [this, session, &commandHandler](asio::error_code ec) {
         if (ec) {
             std::cerr << "Accept failed: " << ec.message() << std::endl;
             return;
         }
 
-        _socket.set_option(asio::ip::tcp::no_delay(true));
-        handleNewConnection(commandHandler);
-
-        _socket.close();
+        // The session keeps itself alive while serving its client
+        session->start();
 
         acceptRegister(commandHandler);
     };
 
-    _acceptor.async_accept(_socket, peerHandler);
+    _acceptor.async_accept(session->getSocket(), peerHandler);
 }
 
 bool CRemoteProcessorServer::process(IRemoteCommandHandler &commandHandler)
 {
     acceptRegister(commandHandler);
 
-    asio::error_code ec;
+    // One error per worker, the calling thread being the first one
+    std::vector<asio::error_code> errors(_workerCount);
+    std::vector<std::thread> workers;
 
-    _io_service.run(ec);
+    for (size_t worker = 1; worker < _workerCount; worker++) {
 
-    if (ec) {
-        std::cerr << "Server failed: " << ec.message() << std::endl;
+        asio::error_code &ec = errors[worker];
+        workers.emplace_back([this, &ec] { _io_service.run(ec); });
     }
+    _io_service.run(errors.front());
 
-    return ec.value() == 0;
-}
-
-// New connection
-void CRemoteProcessorServer::handleNewConnection(IRemoteCommandHandler &commandHandler)
-{
-    // Process all incoming requests from the client
-    while (true) {
-
-        // Process requests
-        // Create command message
-        CRequestMessage requestMessage;
-
-        string strError;
-        ///// Receive command
-        CRequestMessage::Result res;
-        res = requestMessage.serialize(Socket(_socket), false, strError);
-
-        switch (res) {
-        case CRequestMessage::error:
-            std::cout << "Error while receiving message: " << strError << std::endl;
-        // fall through
-        case CRequestMessage::peerDisconnected:
-            // Consider peer disconnection as normal, no log
-            return; // Bail out
-        case CRequestMessage::success:
-            break; // No error, continue
-        }
-
-        // Actually process the request
-        bool bSuccess;
-
-        string strResult;
+    for (auto &worker : workers) {
 
-        bSuccess = commandHandler.remoteCommandProcess(requestMessage, strResult);
+        worker.join();
+    }
 
-        // Send back answer
-        // Create answer message
-        CAnswerMessage answerMessage(strResult, bSuccess);
+    for (const auto &ec : errors) {
 
-        ///// Send answer
-        res = answerMessage.serialize(_socket, true, strError);
+        if (ec) {
+            std::cerr << "Server failed: " << ec.message() << std::endl;
 
-        switch (res) {
-        case CRequestMessage::peerDisconnected:
-        // Peer should not disconnect while waiting for an answer
-        // Fall through to log the error and bail out
-        case CRequestMessage::error:
-            std::cout << "Error while receiving message: " << strError << std::endl;
-            return; // Bail out
-        case CRequestMessage::success:
-            break; // No error, continue
+            return false;
         }
     }
+    return true;
 }
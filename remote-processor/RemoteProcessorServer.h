@@ -34,30 +34,58 @@
 #include <stdint.h>
 #include "RemoteProcessorServerInterface.h"
 #include <asio.hpp>
+#include <string>
 
 class IRemoteCommandHandler;
 
 class REMOTE_PROCESSOR_EXPORT CRemoteProcessorServer : public IRemoteProcessorServerInterface
 {
 public:
+    /** Listen on a TCP port, on all interfaces */
     CRemoteProcessorServer(uint16_t uiPort);
+
+    /** Listen on a Unix domain socket
+     *
+     * @param[in] strSocketPath path of the socket. A socket left there by an instance which
+     *                          did not stop cleanly is replaced; anything else makes start fail.
+     */
+    CRemoteProcessorServer(const std::string &strSocketPath);
     virtual ~CRemoteProcessorServer();
 
     // State
     virtual bool start(std::string &error);
     virtual bool stop();
+
+    /** Serve clients until stopped
+     *
+     * Each client connection gets its own session. Sessions are served by a pool of threads,
+     * hence the command handler may be called concurrently.
+     *
+     * @param[in] commandHandler processes the requests of all clients
+     *
+     * @return true if the server was stopped, false if it failed
+     */
     bool process(IRemoteCommandHandler &commandHandler);
 
 private:
+    /** Wait for the next client connection */
     void acceptRegister(IRemoteCommandHandler &commandHandler);
 
-    // New connection
-    void handleNewConnection(IRemoteCommandHandler &commandHandler);
+    /** Threads serving sessions
+     *
+     * Few clients are expected at once, typically a tuning tool and a monitoring agent.
+     */
+    static const size_t _workerCount = 4;
+
+    /** @return where the server listens, for error reporting */
+    std::string getAddress() const;
 
     // Port number
-    uint16_t _uiPort;
+    uint16_t _uiPort{0};
+    // Unix domain socket path, empty when listening on the port
+    std::string _strSocketPath;
 
     asio::io_service _io_service;
-    asio::ip::tcp::acceptor _acceptor;
-    asio::ip::tcp::socket _socket;
+    /** Either a TCP or a Unix domain socket acceptor */
+    asio::basic_socket_acceptor<asio::generic::stream_protocol> _acceptor;
 };
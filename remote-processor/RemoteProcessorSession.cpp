@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "RemoteProcessorSession.h"
+#include "RequestMessage.h"
+#include "AnswerMessage.h"
+#include "BatchRequestMessage.h"
+#include "BatchAnswerMessage.h"
+#include "RemoteCommandHandler.h"
+#include <iostream>
+
+using std::string;
+
+CRemoteProcessorSession::CRemoteProcessorSession(asio::io_service &ioService,
+                                                 IRemoteCommandHandler &commandHandler)
+    : _socket(ioService), _commandHandler(commandHandler)
+{
+}
+
+asio::generic::stream_protocol::socket &CRemoteProcessorSession::getSocket()
+{
+    return _socket;
+}
+
+void CRemoteProcessorSession::start()
+{
+    // Fails for Unix domain sockets, or if the client is already gone, which the first read
+    // reports anyway
+    asio::error_code ec;
+    _socket.set_option(asio::ip::tcp::no_delay(true), ec);
+
+    readHeader();
+}
+
+void CRemoteProcessorSession::readHeader()
+{
+    _frame.resize(CMessage::headerSize);
+
+    auto self = shared_from_this();
+    auto headerHandler = [self](const asio::error_code &ec, size_t /*size*/) {
+        if (ec) {
+            // Consider peer disconnection as normal, no log
+            if (ec != asio::error::eof) {
+                std::cout << "Error while receiving message: " << ec.message() << std::endl;
+            }
+            return; // Bail out
+        }
+
+        string strError;
+        size_t remainingSize;
+
+        if (!CMessage::checkFrameHeader(self->_frame, remainingSize, strError)) {
+            std::cout << "Error while receiving message: " << strError << std::endl;
+            return; // Bail out
+        }
+        self->readFrame(remainingSize);
+    };
+
+    asio::async_read(_socket, asio::buffer(_frame), headerHandler);
+}
+
+void CRemoteProcessorSession::readFrame(size_t size)
+{
+    _frame.resize(size);
+
+    auto self = shared_from_this();
+    auto frameHandler = [self](const asio::error_code &ec, size_t /*size*/) {
+        if (ec) {
+            std::cout << "Error while receiving message: " << ec.message() << std::endl;
+            return; // Bail out
+        }
+        self->processRequest();
+    };
+
+    asio::async_read(_socket, asio::buffer(_frame), frameHandler);
+}
+
+void CRemoteProcessorSession::processRequest()
+{
+    string strError;
+
+    // Requests are possibly processed concurrently with requests of other sessions
+    bool bProcessed = CMessage::peekMsgId(_frame) == CMessage::MsgType::EBatchRequest
+                          ? processBatchRequest(strError)
+                          : processCommandRequest(strError);
+
+    if (!bProcessed) {
+        std::cout << "Error while receiving message: " << strError << std::endl;
+        return; // Bail out
+    }
+
+    // Send back answer
+    auto self = shared_from_this();
+    auto answerHandler = [self](const asio::error_code &ec, size_t /*size*/) {
+        if (ec) {
+            // Peer should not disconnect while waiting for an answer
+            std::cout << "Error while sending message: " << ec.message() << std::endl;
+            return; // Bail out
+        }
+        self->readHeader();
+    };
+
+    asio::async_write(_socket, asio::buffer(_frame), answerHandler);
+}
+
+bool CRemoteProcessorSession::processCommandRequest(string &strError)
+{
+    CRequestMessage requestMessage;
+
+    if (!requestMessage.collectFrame(_frame, strError)) {
+        return false;
+    }
+
+    string strResult;
+    bool bSuccess = _commandHandler.remoteCommandProcess(requestMessage, strResult);
+
+    CAnswerMessage answerMessage(strResult, bSuccess);
+    _frame = answerMessage.buildFrame();
+
+    return true;
+}
+
+bool CRemoteProcessorSession::processBatchRequest(string &strError)
+{
+    CBatchRequestMessage batchRequestMessage;
+
+    if (!batchRequestMessage.collectFrame(_frame, strError)) {
+        return false;
+    }
+
+    // Commands are processed in order, whatever their outcome
+    CBatchAnswerMessage batchAnswerMessage;
+
+    for (size_t command = 0; command < batchRequestMessage.getCommandCount(); command++) {
+
+        string strResult;
+        bool bSuccess = _commandHandler.remoteCommandProcess(
+            batchRequestMessage.getCommand(command), strResult);
+
+        batchAnswerMessage.addAnswer(strResult, bSuccess);
+    }
+    _frame = batchAnswerMessage.buildFrame();
+
+    return true;
+}
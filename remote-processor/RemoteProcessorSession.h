@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "NonCopyable.hpp"
+#include <asio.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+class IRemoteCommandHandler;
+
+/** Connection of a client to the remote processor server
+ *
+ * Requests are read and answered asynchronously, one at a time, until the client disconnects.
+ * A session only lives as long as one of its asynchronous operations is pending, hence has to be
+ * shared.
+ */
+class CRemoteProcessorSession : public std::enable_shared_from_this<CRemoteProcessorSession>,
+                                private utility::NonCopyable
+{
+public:
+    CRemoteProcessorSession(asio::io_service &ioService, IRemoteCommandHandler &commandHandler);
+
+    /** @return the socket to accept the client connection on */
+    asio::generic::stream_protocol::socket &getSocket();
+
+    /** Serve the connected client */
+    void start();
+
+private:
+    /** Wait for the next request, starting with its header */
+    void readHeader();
+
+    /** Read the rest of the request frame
+     *
+     * @param[in] size frame size following the header
+     */
+    void readFrame(size_t size);
+
+    /** Process the received request and send back the answer */
+    void processRequest();
+
+    /** Process a single command request, replacing the received frame by the answer one
+     *
+     * @param[out] strError on failure, a string explaining the error,
+     *                      on success, undefined.
+     *
+     * @return false if the request could not be collected, true otherwise
+     */
+    bool processCommandRequest(std::string &strError);
+
+    /** Process a batch request, replacing the received frame by the answer one
+     *
+     * @see processCommandRequest
+     */
+    bool processBatchRequest(std::string &strError);
+
+    /** Either a TCP or a Unix domain socket */
+    asio::generic::stream_protocol::socket _socket;
+    IRemoteCommandHandler &_commandHandler;
+
+    /** Frame being read or written */
+    std::vector<uint8_t> _frame;
+};
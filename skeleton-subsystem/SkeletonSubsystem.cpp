@@ -31,6 +31,7 @@
 #include "SkeletonMappingKeys.h"
 #include "SubsystemObjectFactory.h"
 #include "SkeletonSubsystemObject.h"
+#include <iostream>
 
 // Implementation
 CSkeletonSubsystem::CSkeletonSubsystem(const std::string &strName, core::log::Logger &logger)
@@ -45,3 +46,32 @@ CSkeletonSubsystem::CSkeletonSubsystem(const std::string &strName, core::log::Lo
     addSubsystemObjectFactory(
         new TSubsystemObjectFactory<CSkeletonSubsystemObject>("Message", 1 << ESkeletonOwner));
 }
+
+bool CSkeletonSubsystem::syncSubsystemObjects(
+    const std::vector<CSubsystemObject *> &subsystemObjects, bool bBack, std::string &strError)
+{
+    // Open here a single session for the whole batch
+    std::cout << "Opening HW session for " << subsystemObjects.size() << " object(s)"
+              << std::endl;
+
+    bool bSuccess = true;
+
+    for (CSubsystemObject *pSubsystemObject : subsystemObjects) {
+
+        // All objects of this subsystem are created by the skeleton factory
+        auto *pSkeletonSubsystemObject = static_cast<CSkeletonSubsystemObject *>(pSubsystemObject);
+
+        // Synchronize every object, even after a failure, but report the first error only
+        std::string strObjectError;
+        if (!pSkeletonSubsystemObject->synchronize(bBack, strObjectError) && bSuccess) {
+
+            strError = strObjectError;
+            bSuccess = false;
+        }
+    }
+
+    // Close here the session
+    std::cout << "Closing HW session" << std::endl;
+
+    return bSuccess;
+}
@@ -31,8 +31,17 @@
 
 #include "Subsystem.h"
 
+#include <string>
+#include <vector>
+
 class CSkeletonSubsystem : public CSubsystem
 {
 public:
     CSkeletonSubsystem(const std::string &strName, core::log::Logger &logger);
+
+protected:
+    // from CSubsystem
+    // Synchronize all the objects within a single hardware session
+    bool syncSubsystemObjects(const std::vector<CSubsystemObject *> &subsystemObjects,
+                              bool bBack, std::string &strError) override;
 };
@@ -40,6 +40,9 @@ public:
                              CInstanceConfigurableElement *pInstanceConfigurableElement,
                              const CMappingContext &context, core::log::Logger &logger);
 
+    // Let the skeleton subsystem synchronize its objects in a batch
+    using CSubsystemObject::synchronize;
+
 protected:
     // from CSubsystemObject
     // Sync to/from HW
@@ -34,6 +34,8 @@
 #include <IntrospectionEntryPoint.h>
 #include "Test.hpp"
 #include <catch.hpp>
+#include <list>
+#include <memory>
 #include <string>
 
 using std::string;
@@ -130,4 +132,205 @@ SCENARIO_METHOD(BoolPF, "Auto sync")
         }
     }
 }
+SCENARIO_METHOD(BoolPF, "Unchanged parameters are not synchronized")
+{
+    GIVEN ("A Pfw that starts") {
+        REQUIRE_NOTHROW(start());
+        size_t sendCount = introspectionSubsystem::getSendToHWCount();
+
+        WHEN ("Forcing the application of the configuration already applied") {
+            REQUIRE_NOTHROW(setTuningMode(true));
+            REQUIRE_NOTHROW(setTuningMode(false));
+
+            THEN ("No synchronization occurs") {
+                CHECK(introspectionSubsystem::getSendToHWCount() == sendCount);
+            }
+        }
+    }
+}
+SCENARIO_METHOD(BoolPF, "Subsystem objects are synchronized in batches")
+{
+    GIVEN ("A Pfw that starts with autosync off and a modified parameter") {
+        REQUIRE_NOTHROW(start());
+        REQUIRE_NOTHROW(setAutoSync(false));
+        REQUIRE_NOTHROW(setParameterValue(true));
+        size_t batchCount = introspectionSubsystem::getSyncBatchCount();
+        size_t sendCount = introspectionSubsystem::getSendToHWCount();
+
+        WHEN ("Turning autosync on") {
+            REQUIRE_NOTHROW(setAutoSync(true));
+
+            THEN ("The subsystem synchronizes its dirty objects in one batch") {
+                CHECK(introspectionSubsystem::getSyncBatchCount() == batchCount + 1);
+                CHECK(introspectionSubsystem::getSendToHWCount() == sendCount + 1);
+                CHECK(introspectionSubsystem::getParameterValue());
+            }
+        }
+    }
+}
+SCENARIO_METHOD(BoolPF, "Asynchronous synchronization")
+{
+    GIVEN ("A Pfw that synchronizes subsystems from their own thread") {
+        REQUIRE_NOTHROW(setAsynchronousSync(true));
+        CHECK(getAsynchronousSync());
+        REQUIRE_NOTHROW(start());
+
+        THEN ("Synchronization of the initial application completes without error") {
+            CHECK(getSyncCompletion().get() == std::list<std::string>{});
+            CHECK_FALSE(introspectionSubsystem::getParameterValue());
+
+            AND_THEN ("The policy can not be changed while running") {
+                CHECK_THROWS_AS(setAsynchronousSync(false), Exception);
+            }
+        }
+        WHEN ("A modified configuration is applied") {
+            getSyncCompletion().wait();
+            size_t sendCount = introspectionSubsystem::getSendToHWCount();
+
+            REQUIRE_NOTHROW(setAutoSync(false));
+            REQUIRE_NOTHROW(setParameterValue(true));
+            REQUIRE_NOTHROW(setTuningMode(true));
+            REQUIRE_NOTHROW(setTuningMode(false));
+
+            THEN ("Its synchronization completes without error") {
+                CHECK(getSyncCompletion().get() == std::list<std::string>{});
+                CHECK(introspectionSubsystem::getSendToHWCount() == sendCount + 1);
+                CHECK(introspectionSubsystem::getParameterValue());
+            }
+        }
+    }
+}
+SCENARIO_METHOD(BoolPF, "Asynchronous synchronization failure")
+{
+    GIVEN ("A Pfw that synchronizes subsystems from their own thread") {
+        REQUIRE_NOTHROW(setAsynchronousSync(true));
+        REQUIRE_NOTHROW(start());
+        getSyncCompletion().wait();
+
+        WHEN ("A modified configuration fails to be synchronized") {
+            REQUIRE_NOTHROW(setAutoSync(false));
+            REQUIRE_NOTHROW(setParameterValue(true));
+
+            introspectionSubsystem::setSendToHWFailure(true);
+            REQUIRE_NOTHROW(setTuningMode(true));
+            REQUIRE_NOTHROW(setTuningMode(false));
+            std::list<std::string> errors = getSyncCompletion().get();
+            introspectionSubsystem::setSendToHWFailure(false);
+
+            THEN ("The failure is reported") {
+                CHECK(errors.size() == 1);
+                CHECK_FALSE(introspectionSubsystem::getParameterValue());
+
+                AND_WHEN ("Configurations are applied again") {
+                    size_t sendCount = introspectionSubsystem::getSendToHWCount();
+
+                    REQUIRE_NOTHROW(setTuningMode(true));
+                    REQUIRE_NOTHROW(setTuningMode(false));
+
+                    THEN ("The failed synchronization is retried") {
+                        CHECK(getSyncCompletion().get() == std::list<std::string>{});
+                        CHECK(introspectionSubsystem::getSendToHWCount() == sendCount + 1);
+                        CHECK(introspectionSubsystem::getParameterValue());
+                    }
+                }
+            }
+        }
+    }
+}
+/** A parameter framework with a boolean parameter belonging to no domain */
+struct RogueBoolPF : public ParameterFramework
+{
+    RogueBoolPF() : ParameterFramework{createConfig()} {}
+
+    /** Put the parameter in an always applicable configuration holding its current value */
+    void addParameterToDomain()
+    {
+        std::unique_ptr<CommandHandlerInterface> commandHandler(createCommandHandler());
+        std::string output;
+        REQUIRE_NOTHROW(setTuningMode(true));
+        REQUIRE(commandHandler->process("createDomain", {"Domain"}, output));
+        REQUIRE(commandHandler->process("addElement", {"Domain", "/test/test/param"}, output));
+        REQUIRE(commandHandler->process("createConfiguration", {"Domain", "Conf"}, output));
+        REQUIRE(commandHandler->process("setRule", {"Domain", "Conf", "All{}"}, output));
+        REQUIRE_NOTHROW(setTuningMode(false));
+    }
+
+private:
+    static Config createConfig()
+    {
+        Config config;
+        config.instances = R"(<BooleanParameter Name="param" Mapping="Object"/>)";
+        config.plugins = {{"", {"introspection-subsystem"}}};
+        config.subsystemType = "INTROSPECTION";
+        return config;
+    }
+};
+
+SCENARIO_METHOD(RogueBoolPF, "Directly synchronized parameters are not synchronized again")
+{
+    GIVEN ("A started Pfw") {
+        REQUIRE_NOTHROW(start());
+
+        WHEN ("Setting the parameter back and forth through a typed handle") {
+            auto param = createTypedParameterHandle<bool>("/test/test/param");
+            std::string error;
+            REQUIRE(param->set(true, error));
+            REQUIRE(param->set(false, error));
+            size_t sendCount = introspectionSubsystem::getSendToHWCount();
+
+            AND_WHEN ("Applying a configuration holding the current value") {
+                addParameterToDomain();
+
+                THEN ("The parameter is not synchronized again") {
+                    CHECK(introspectionSubsystem::getSendToHWCount() == sendCount);
+                }
+            }
+        }
+        WHEN ("Setting the parameter back and forth while tuning") {
+            REQUIRE_NOTHROW(setTuningMode(true));
+            std::string value = "1";
+            REQUIRE_NOTHROW(setParameter("/test/test/param", value));
+            value = "0";
+            REQUIRE_NOTHROW(setParameter("/test/test/param", value));
+            REQUIRE_NOTHROW(setTuningMode(false));
+            size_t sendCount = introspectionSubsystem::getSendToHWCount();
+
+            AND_WHEN ("Applying a configuration holding the current value") {
+                addParameterToDomain();
+
+                THEN ("The parameter is not synchronized again") {
+                    CHECK(introspectionSubsystem::getSendToHWCount() == sendCount);
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("Destruction with pending asynchronous synchronizations")
+{
+    GIVEN ("A Pfw that synchronizes subsystems from their own thread") {
+        std::unique_ptr<BoolPF> pfw(new BoolPF);
+        REQUIRE_NOTHROW(pfw->setAsynchronousSync(true));
+        REQUIRE_NOTHROW(pfw->start());
+        pfw->getSyncCompletion().wait();
+
+        WHEN ("It is destroyed while synchronizations are still queued") {
+            size_t batchCount = introspectionSubsystem::getSyncBatchCount();
+            introspectionSubsystem::setSyncDelay(50);
+
+            REQUIRE_NOTHROW(pfw->setAutoSync(false));
+            for (bool value : {true, false}) {
+                REQUIRE_NOTHROW(pfw->setParameterValue(value));
+                REQUIRE_NOTHROW(pfw->setTuningMode(true));
+                REQUIRE_NOTHROW(pfw->setTuningMode(false));
+            }
+            pfw.reset();
+            introspectionSubsystem::setSyncDelay(0);
+
+            THEN ("Queued synchronizations are completed by the plugin subsystem") {
+                CHECK(introspectionSubsystem::getSyncBatchCount() == batchCount + 2);
+            }
+        }
+    }
+}
 } // namespace parameterFramework
@@ -32,6 +32,7 @@
 #include "Config.hpp"
 #include "StoreLogger.hpp"
 #include "ParameterFramework.hpp"
+#include "ElementHandle.hpp"
 
 #include <catch.hpp>
 
@@ -82,6 +83,18 @@ SCENARIO("Logger should receive info and warnings", "[log]")
                             CHECK(logger.getLogs() != Logs{});
                         }
                     }
+                    AND_WHEN ("Info logs are disabled") {
+                        logger.infoEnabled = false;
+                        THEN ("Start should succeed") {
+                            REQUIRE_NOTHROW(pfw.start());
+                            AND_THEN ("The logger should have stored warning logs only") {
+                                using Logs = StoreLogger::Logs;
+                                using Level = StoreLogger::Log::Level;
+                                CHECK(logger.filter(Level::warning) != Logs{});
+                                CHECK(logger.filter(Level::info) == Logs{});
+                            }
+                        }
+                    }
                     AND_WHEN ("A nullptr logger is set") {
                         pfw.setLogger(nullptr);
                         THEN ("Start should succeed") {
@@ -178,4 +191,141 @@ SCENARIO_METHOD(ParameterFramework, "Raw value space")
     }
 }
 
+SCENARIO("Parallel back synchronization", "[start]")
+{
+    GIVEN ("Subsystems without domain, back synchronized by several threads") {
+        Config config;
+        config.frameworkAttributes = "BackSynchronizationThreads='4'";
+        config.instances = R"(<IntegerParameter Name="first" Size="8" Max="5"/>)";
+        config.subsystems = R"(<Subsystem Name="second" Type="Virtual">
+                                   <ComponentLibrary/>
+                                   <InstanceDefinition>
+                                       <IntegerParameter Name="second" Size="8" Min="3"/>
+                                   </InstanceDefinition>
+                               </Subsystem>
+                               <Subsystem Name="third" Type="Virtual">
+                                   <ComponentLibrary/>
+                                   <InstanceDefinition>
+                                       <BooleanParameter Name="third"/>
+                                   </InstanceDefinition>
+                               </Subsystem>)";
+        ParameterFramework pfw{config};
+
+        WHEN ("Starting") {
+            REQUIRE_NOTHROW(pfw.start());
+
+            THEN ("All parameters hold their default value") {
+                std::string value;
+                REQUIRE_NOTHROW(pfw.getParameter("/test/test/first", value));
+                CHECK(value == "0");
+                REQUIRE_NOTHROW(pfw.getParameter("/test/second/second", value));
+                CHECK(value == "3");
+                REQUIRE_NOTHROW(pfw.getParameter("/test/third/third", value));
+                CHECK(value == "0");
+            }
+        }
+    }
+}
+
+SCENARIO("Element access by path", "[path]")
+{
+    GIVEN ("A started parameter framework") {
+        Config config;
+        config.instances = R"(<IntegerParameter Name="scalar" Size="8"/>
+                              <IntegerParameter Name="array" Size="8" ArrayLength="3"/>)";
+        ParameterFramework pfw{config};
+        REQUIRE_NOTHROW(pfw.start());
+        REQUIRE_NOTHROW(pfw.setTuningMode(true));
+        std::string value;
+
+        THEN ("Parameters are accessible by path") {
+            value = "4";
+            REQUIRE_NOTHROW(pfw.setParameter("/test/test/scalar", value));
+            REQUIRE_NOTHROW(pfw.getParameter("/test/test/scalar", value));
+            CHECK(value == "4");
+        }
+        THEN ("Array items are accessible by path") {
+            value = "5";
+            REQUIRE_NOTHROW(pfw.setParameter("/test/test/array/1", value));
+            REQUIRE_NOTHROW(pfw.getParameter("/test/test/array", value));
+            CHECK(value == "0 5 0");
+        }
+        THEN ("Elements which are not parameters can not be accessed") {
+            CHECK_THROWS_AS(pfw.getParameter("/test/test", value), Exception);
+            CHECK_THROWS_AS(pfw.getParameter("/test/test/missing", value), Exception);
+        }
+        THEN ("Handles can be created by path") {
+            CHECK_NOTHROW(ElementHandle(pfw, "/test/test"));
+            CHECK_NOTHROW(ElementHandle(pfw, "/test/test/array"));
+            CHECK_THROWS_AS(ElementHandle(pfw, "/test/test/missing"), Exception);
+        }
+    }
+}
+
+SCENARIO("Domains export", "[xml][domains]")
+{
+    GIVEN ("A parameter framework without domains") {
+        ParameterFramework pfw;
+        REQUIRE_NOTHROW(pfw.start());
+
+        THEN ("The exported root element is empty") {
+            CHECK(pfw.exportDomainsXml(true) == R"(<?xml version="1.0" encoding="UTF-8"?>
+<ConfigurableDomains SystemClassName="test"/>
+)");
+        }
+    }
+    GIVEN ("A parameter framework with domains") {
+        Config config;
+        config.instances = R"(<BooleanParameter Name="param"/>)";
+        config.domains = R"(<ConfigurableDomain Name="first">
+                                <Configurations>
+                                    <Configuration Name="conf"/>
+                                </Configurations>
+                                <ConfigurableElements>
+                                    <ConfigurableElement Path="/test/test/param"/>
+                                </ConfigurableElements>
+                                <Settings>
+                                    <Configuration Name="conf">
+                                        <ConfigurableElement Path="/test/test/param">
+                                            <BooleanParameter Name="param">1</BooleanParameter>
+                                        </ConfigurableElement>
+                                    </Configuration>
+                                </Settings>
+                            </ConfigurableDomain>
+                            <ConfigurableDomain Name="second">
+                                <Configurations/>
+                                <ConfigurableElements/>
+                            </ConfigurableDomain>)";
+        ParameterFramework pfw{config};
+        REQUIRE_NOTHROW(pfw.start());
+
+        THEN ("Each domain is exported as a formatted child of the root element") {
+            CHECK(pfw.exportDomainsXml(true) == R"(<?xml version="1.0" encoding="UTF-8"?>
+<ConfigurableDomains SystemClassName="test">
+  <ConfigurableDomain Name="first" SequenceAware="false">
+    <Configurations>
+      <Configuration Name="conf"/>
+    </Configurations>
+    <ConfigurableElements>
+      <ConfigurableElement Path="/test/test/param"/>
+    </ConfigurableElements>
+    <Settings>
+      <Configuration Name="conf">
+        <ConfigurableElement Path="/test/test/param">
+          <BooleanParameter Name="param">1</BooleanParameter>
+        </ConfigurableElement>
+      </Configuration>
+    </Settings>
+  </ConfigurableDomain>
+  <ConfigurableDomain Name="second" SequenceAware="false">
+    <Configurations/>
+    <ConfigurableElements/>
+    <Settings/>
+  </ConfigurableDomain>
+</ConfigurableDomains>
+)");
+        }
+    }
+}
+
 } // namespace parameterFramework
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Config.hpp"
+#include "ParameterFramework.hpp"
+#include "Test.hpp"
+
+#include <SelectionCriterionInterface.h>
+#include <SelectionCriterionTypeInterface.h>
+
+#include <catch.hpp>
+
+#include <chrono>
+#include <string>
+
+using std::string;
+
+// Hidden benchmarks, run them explicitly with: parameterFunctionalTest "[benchmark]"
+
+namespace parameterFramework
+{
+
+/** A parameter framework with a domain switching configuration on each criterion change */
+struct ModePF : public ParameterFramework
+{
+    ModePF() : ParameterFramework{createConfig()}
+    {
+        string error;
+
+        auto modeType = createSelectionCriterionType(false);
+        REQUIRE(modeType->addValuePair(0, "idle", error));
+        REQUIRE(modeType->addValuePair(1, "call", error));
+        REQUIRE(modeType->addValuePair(2, "media", error));
+        mMode = createSelectionCriterion("Mode", modeType);
+    }
+
+    ISelectionCriterionInterface *mMode;
+
+private:
+    static string createConfiguration(const string &name, const string &mode)
+    {
+        return R"(<Configuration Name=")" + name + R"(">
+                      <CompoundRule Type="All">
+                          <SelectionCriterionRule SelectionCriterion="Mode" MatchesWhen="Is"
+                              Value=")" + mode + R"("/>
+                      </CompoundRule>
+                  </Configuration>)";
+    }
+
+    static string createSettings(const string &name, int value)
+    {
+        return R"(<Configuration Name=")" + name + R"(">
+                      <ConfigurableElement Path="/test/test/mode">
+                          <IntegerParameter Name="mode">)" + std::to_string(value) +
+               R"(</IntegerParameter>
+                      </ConfigurableElement>
+                  </Configuration>)";
+    }
+
+    static Config createConfig()
+    {
+        Config config;
+        config.instances = R"(<IntegerParameter Name="mode" Size="8"/>)";
+        config.domains = R"(<ConfigurableDomain Name="ModeDomain"><Configurations>)" +
+                         createConfiguration("Idle", "idle") +
+                         createConfiguration("Call", "call") +
+                         createConfiguration("Media", "media") +
+                         R"(</Configurations>
+                            <ConfigurableElements>
+                                <ConfigurableElement Path="/test/test/mode"/>
+                            </ConfigurableElements>
+                            <Settings>)" +
+                         createSettings("Idle", 0) + createSettings("Call", 1) +
+                         createSettings("Media", 2) + R"(</Settings></ConfigurableDomain>)";
+        return config;
+    }
+};
+
+/** Logger discarding every log, possibly without the PF formatting info ones */
+class NullLogger : public CParameterMgrFullConnector::ILogger
+{
+public:
+    NullLogger(bool infoEnabled) : mInfoEnabled(infoEnabled) {}
+
+    void info(const std::string &) override {}
+    void warning(const std::string &) override {}
+    bool isInfoEnabled() const override { return mInfoEnabled; }
+
+private:
+    bool mInfoEnabled;
+};
+
+SCENARIO("Criterion change and application cost with and without info logs",
+         "[.][benchmark][log]")
+{
+    const int cycles = 100000;
+
+    for (bool infoEnabled : {true, false}) {
+
+        NullLogger logger(infoEnabled);
+        ModePF pfw;
+        pfw.setLogger(&logger);
+        REQUIRE_NOTHROW(pfw.start());
+
+        auto begin = std::chrono::steady_clock::now();
+        for (int cycle = 0; cycle < cycles; ++cycle) {
+            pfw.mMode->setCriterionState(cycle % 3);
+            pfw.applyConfigurations();
+        }
+        auto elapsed = std::chrono::steady_clock::now() - begin;
+        auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+
+        WARN("Info logs " << (infoEnabled ? "enabled" : "disabled") << ": " << nanoseconds / cycles
+                          << " ns per setCriterionState + applyConfigurations cycle");
+    }
+}
+} // namespace parameterFramework
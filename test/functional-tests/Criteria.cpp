@@ -0,0 +1,429 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Config.hpp"
+#include "ParameterFramework.hpp"
+#include "ElementHandle.hpp"
+#include "Test.hpp"
+
+#include <SelectionCriterionInterface.h>
+#include <SelectionCriterionTypeInterface.h>
+
+#include <catch.hpp>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using std::string;
+
+namespace parameterFramework
+{
+
+/** A parameter framework with two domains, each one depending on a different criterion and
+ * holding a parameter of a different subsystem. */
+struct CriteriaPF : public ParameterFramework
+{
+    CriteriaPF() : ParameterFramework{createConfig()}
+    {
+        string error;
+
+        auto modeType = createSelectionCriterionType(false);
+        REQUIRE(modeType->addValuePair(0, "idle", error));
+        REQUIRE(modeType->addValuePair(1, "call", error));
+        REQUIRE(modeType->addValuePair(2, "media", error));
+        mMode = createSelectionCriterion("Mode", modeType);
+
+        auto routeType = createSelectionCriterionType(true);
+        REQUIRE(routeType->addValuePair(1, "speaker", error));
+        REQUIRE(routeType->addValuePair(2, "headset", error));
+        mRoute = createSelectionCriterion("Route", routeType);
+    }
+
+    string getValue(const string &path)
+    {
+        string value;
+        getParameter(path, value);
+        return value;
+    }
+
+    /** @return the given restored area counter of the status command output */
+    size_t getRestoredAreaCount(const string &counter)
+    {
+        std::unique_ptr<CommandHandlerInterface> commandHandler(createCommandHandler());
+        string status;
+        REQUIRE(commandHandler->process("status", {}, status));
+
+        auto section = status.find("Restored Areas:");
+        REQUIRE(section != string::npos);
+        auto line = status.find(counter + ": ", section);
+        REQUIRE(line != string::npos);
+
+        return std::stoul(status.substr(line + counter.size() + 2));
+    }
+
+    ISelectionCriterionInterface *mMode;
+    ISelectionCriterionInterface *mRoute;
+
+private:
+    static Config createConfig()
+    {
+        Config config;
+        config.instances = R"(<IntegerParameter Name="mode" Size="8"/>
+                              <IntegerParameter Name="shared" Size="8"/>)";
+        config.subsystems = R"(<Subsystem Name="route" Type="Virtual">
+                                   <ComponentLibrary/>
+                                   <InstanceDefinition>
+                                       <IntegerParameter Name="route" Size="8"/>
+                                   </InstanceDefinition>
+                               </Subsystem>)";
+        config.domains = R"(<ConfigurableDomain Name="ModeDomain">
+                                <Configurations>
+                                    <Configuration Name="Call">
+                                        <CompoundRule Type="All">
+                                            <SelectionCriterionRule SelectionCriterion="Mode"
+                                                MatchesWhen="Is" Value="call"/>
+                                        </CompoundRule>
+                                    </Configuration>
+                                    <Configuration Name="Media">
+                                        <CompoundRule Type="All">
+                                            <SelectionCriterionRule SelectionCriterion="Mode"
+                                                MatchesWhen="Is" Value="media"/>
+                                        </CompoundRule>
+                                    </Configuration>
+                                    <Configuration Name="Default">
+                                        <CompoundRule Type="All"/>
+                                    </Configuration>
+                                </Configurations>
+                                <ConfigurableElements>
+                                    <ConfigurableElement Path="/test/test/mode"/>
+                                    <ConfigurableElement Path="/test/test/shared"/>
+                                </ConfigurableElements>
+                                <Settings>
+                                    <Configuration Name="Call">
+                                        <ConfigurableElement Path="/test/test/mode">
+                                            <IntegerParameter Name="mode">1</IntegerParameter>
+                                        </ConfigurableElement>
+                                        <ConfigurableElement Path="/test/test/shared">
+                                            <IntegerParameter Name="shared">5</IntegerParameter>
+                                        </ConfigurableElement>
+                                    </Configuration>
+                                    <Configuration Name="Media">
+                                        <ConfigurableElement Path="/test/test/mode">
+                                            <IntegerParameter Name="mode">2</IntegerParameter>
+                                        </ConfigurableElement>
+                                        <ConfigurableElement Path="/test/test/shared">
+                                            <IntegerParameter Name="shared">5</IntegerParameter>
+                                        </ConfigurableElement>
+                                    </Configuration>
+                                    <Configuration Name="Default">
+                                        <ConfigurableElement Path="/test/test/mode">
+                                            <IntegerParameter Name="mode">0</IntegerParameter>
+                                        </ConfigurableElement>
+                                        <ConfigurableElement Path="/test/test/shared">
+                                            <IntegerParameter Name="shared">5</IntegerParameter>
+                                        </ConfigurableElement>
+                                    </Configuration>
+                                </Settings>
+                            </ConfigurableDomain>
+                            <ConfigurableDomain Name="RouteDomain">
+                                <Configurations>
+                                    <Configuration Name="Headset">
+                                        <CompoundRule Type="All">
+                                            <SelectionCriterionRule SelectionCriterion="Route"
+                                                MatchesWhen="Includes" Value="headset"/>
+                                        </CompoundRule>
+                                    </Configuration>
+                                    <Configuration Name="Default">
+                                        <CompoundRule Type="All"/>
+                                    </Configuration>
+                                </Configurations>
+                                <ConfigurableElements>
+                                    <ConfigurableElement Path="/test/route/route"/>
+                                </ConfigurableElements>
+                                <Settings>
+                                    <Configuration Name="Headset">
+                                        <ConfigurableElement Path="/test/route/route">
+                                            <IntegerParameter Name="route">2</IntegerParameter>
+                                        </ConfigurableElement>
+                                    </Configuration>
+                                    <Configuration Name="Default">
+                                        <ConfigurableElement Path="/test/route/route">
+                                            <IntegerParameter Name="route">1</IntegerParameter>
+                                        </ConfigurableElement>
+                                    </Configuration>
+                                </Settings>
+                            </ConfigurableDomain>)";
+        return config;
+    }
+};
+
+SCENARIO_METHOD(CriteriaPF, "Criterion driven configuration application", "[criteria]")
+{
+    GIVEN ("A started parameter framework") {
+        REQUIRE_NOTHROW(start());
+
+        THEN ("Default configurations are applied") {
+            CHECK(getValue("/test/test/mode") == "0");
+            CHECK(getValue("/test/route/route") == "1");
+        }
+        WHEN ("Changing a criterion and applying configurations") {
+            mMode->setCriterionState(1);
+            applyConfigurations();
+
+            THEN ("Only the depending domain switches configuration") {
+                CHECK(getValue("/test/test/mode") == "1");
+                CHECK(getValue("/test/route/route") == "1");
+            }
+            AND_WHEN ("Changing the other criterion") {
+                mRoute->setCriterionState(2);
+                applyConfigurations();
+
+                THEN ("The other domain switches configuration") {
+                    CHECK(getValue("/test/test/mode") == "1");
+                    CHECK(getValue("/test/route/route") == "2");
+                }
+            }
+            AND_WHEN ("Changing then restoring a criterion before applying") {
+                mMode->setCriterionState(2);
+                mMode->setCriterionState(1);
+                applyConfigurations();
+
+                THEN ("Configurations are unchanged") {
+                    CHECK(getValue("/test/test/mode") == "1");
+                    CHECK(getValue("/test/route/route") == "1");
+                }
+            }
+            AND_WHEN ("Cycling a criterion back through already encountered states") {
+                mMode->setCriterionState(2);
+                applyConfigurations();
+                CHECK(getValue("/test/test/mode") == "2");
+
+                mMode->setCriterionState(0);
+                applyConfigurations();
+                CHECK(getValue("/test/test/mode") == "0");
+
+                mMode->setCriterionState(1);
+                applyConfigurations();
+
+                THEN ("The same configurations are applied again") {
+                    CHECK(getValue("/test/test/mode") == "1");
+                    CHECK(getValue("/test/route/route") == "1");
+                }
+            }
+            AND_WHEN ("Switching to a configuration sharing some values") {
+                size_t copied = getRestoredAreaCount("Copied");
+                size_t skipped = getRestoredAreaCount("Skipped");
+
+                mMode->setCriterionState(2);
+                applyConfigurations();
+
+                THEN ("Only differing areas are restored") {
+                    CHECK(getValue("/test/test/mode") == "2");
+                    CHECK(getValue("/test/test/shared") == "5");
+                    CHECK(getRestoredAreaCount("Copied") == copied + 1);
+                    CHECK(getRestoredAreaCount("Skipped") == skipped + 1);
+                }
+            }
+            AND_WHEN ("Changing a rule without changing any criterion") {
+                REQUIRE_NOTHROW(setApplicationRule("RouteDomain", "Headset", "All{Mode Is call}"));
+                applyConfigurations();
+
+                THEN ("The domain of the changed rule is reevaluated") {
+                    CHECK(getValue("/test/route/route") == "2");
+                }
+            }
+            AND_WHEN ("Changing a rule to a nested compound rule") {
+                REQUIRE_NOTHROW(setApplicationRule(
+                    "RouteDomain", "Headset",
+                    "Any{All{Mode IsNot idle, Route Excludes speaker}, Route Includes headset}"));
+                applyConfigurations();
+
+                THEN ("The new rule decides of the applied configuration") {
+                    CHECK(getValue("/test/route/route") == "2");
+
+                    AND_WHEN ("Changing a criterion the new rule depends on") {
+                        mRoute->setCriterionState(1);
+                        applyConfigurations();
+
+                        THEN ("The new rule is reevaluated") {
+                            CHECK(getValue("/test/route/route") == "1");
+                        }
+                    }
+                }
+            }
+        }
+        WHEN ("Restoring a configuration of adjacent elements while tuning") {
+            std::unique_ptr<CommandHandlerInterface> commandHandler(createCommandHandler());
+            string output;
+            REQUIRE_NOTHROW(setTuningMode(true));
+            REQUIRE(commandHandler->process("setParameter", {"/test/test/mode", "7"}, output));
+            REQUIRE(commandHandler->process("setParameter", {"/test/test/shared", "9"}, output));
+            REQUIRE(commandHandler->process("restoreConfiguration", {"ModeDomain", "Media"},
+                                            output));
+
+            THEN ("All elements of the configuration are restored") {
+                CHECK(getValue("/test/test/mode") == "2");
+                CHECK(getValue("/test/test/shared") == "5");
+                CHECK(getValue("/test/route/route") == "1");
+            }
+        }
+    }
+}
+SCENARIO_METHOD(CriteriaPF, "Memorized configuration application", "[criteria]")
+{
+    GIVEN ("A parameter framework memorizing applicable configurations") {
+        REQUIRE_NOTHROW(setDecisionTable(true));
+        CHECK(getDecisionTable());
+        REQUIRE_NOTHROW(start());
+
+        THEN ("The policy can not be changed while running") {
+            CHECK_THROWS_AS(setDecisionTable(false), Exception);
+        }
+        WHEN ("Cycling criteria back through already encountered states") {
+            for (int state : {1, 2, 0, 1}) {
+                mMode->setCriterionState(state);
+                applyConfigurations();
+                CHECK(getValue("/test/test/mode") == std::to_string(state));
+            }
+            mRoute->setCriterionState(2);
+            applyConfigurations();
+            CHECK(getValue("/test/route/route") == "2");
+
+            mRoute->setCriterionState(0);
+            applyConfigurations();
+
+            THEN ("Configurations are applied as without memorization") {
+                CHECK(getValue("/test/test/mode") == "1");
+                CHECK(getValue("/test/route/route") == "1");
+            }
+        }
+    }
+}
+
+SCENARIO_METHOD(CriteriaPF, "Parallel configuration application", "[criteria]")
+{
+    GIVEN ("A parameter framework applying domains of distinct subsystems concurrently") {
+        REQUIRE_NOTHROW(setParallelApply(true));
+        CHECK(getParallelApply());
+        REQUIRE_NOTHROW(start());
+
+        THEN ("Default configurations are applied") {
+            CHECK(getValue("/test/test/mode") == "0");
+            CHECK(getValue("/test/route/route") == "1");
+        }
+        THEN ("The policy can not be changed while running") {
+            CHECK_THROWS_AS(setParallelApply(false), Exception);
+        }
+        WHEN ("Changing both criteria and applying configurations") {
+            mMode->setCriterionState(2);
+            mRoute->setCriterionState(2);
+            applyConfigurations();
+
+            THEN ("Both domains switch configuration") {
+                CHECK(getValue("/test/test/mode") == "2");
+                CHECK(getValue("/test/route/route") == "2");
+            }
+        }
+        WHEN ("Moving an element to a new domain and applying configurations") {
+            std::unique_ptr<CommandHandlerInterface> commandHandler(createCommandHandler());
+            string output;
+            REQUIRE_NOTHROW(setTuningMode(true));
+            REQUIRE(commandHandler->process("createDomain", {"SharedDomain"}, output));
+            REQUIRE(commandHandler->process("removeElement", {"ModeDomain", "/test/test/shared"},
+                                            output));
+            REQUIRE(commandHandler->process("addElement", {"SharedDomain", "/test/test/shared"},
+                                            output));
+            REQUIRE(commandHandler->process("createConfiguration", {"SharedDomain", "Always"},
+                                            output));
+            REQUIRE(commandHandler->process("setRule", {"SharedDomain", "Always", "All{}"},
+                                            output));
+            REQUIRE(commandHandler->process(
+                "setConfigurationParameter",
+                {"SharedDomain", "Always", "/test/test/shared", "7"}, output));
+            REQUIRE_NOTHROW(setTuningMode(false));
+
+            mMode->setCriterionState(2);
+            mRoute->setCriterionState(2);
+            applyConfigurations();
+
+            THEN ("Domains are applied according to their new elements") {
+                CHECK(getValue("/test/test/mode") == "2");
+                CHECK(getValue("/test/test/shared") == "7");
+                CHECK(getValue("/test/route/route") == "2");
+            }
+        }
+    }
+}
+SCENARIO_METHOD(CriteriaPF, "Reading parameters while applying configurations", "[criteria]")
+{
+    GIVEN ("A started parameter framework and a parameter handle") {
+        REQUIRE_NOTHROW(start());
+        ElementHandle mode(*this, "/test/test/mode");
+
+        WHEN ("Applying configurations") {
+            mMode->setCriterionState(1);
+            applyConfigurations();
+
+            THEN ("The handle immediately reads the new value") {
+                uint32_t value;
+                REQUIRE_NOTHROW(mode.getAsInteger(value));
+                CHECK(value == 1);
+            }
+        }
+        WHEN ("Reading from another thread while applying configurations") {
+            std::atomic<bool> stop{false};
+            std::vector<uint32_t> values;
+
+            std::thread reader([&] {
+                uint32_t value;
+                while (not stop) {
+                    mode.getAsInteger(value);
+                    values.push_back(value);
+                }
+            });
+            for (int iteration = 0; iteration < 100; ++iteration) {
+                mMode->setCriterionState(iteration % 3);
+                applyConfigurations();
+            }
+            stop = true;
+            reader.join();
+
+            THEN ("Only values of applied configurations are read") {
+                for (auto value : values) {
+                    CHECK(value <= 2);
+                }
+            }
+        }
+    }
+}
+} // namespace parameterFramework
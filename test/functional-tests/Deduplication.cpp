@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Config.hpp"
+#include "ParameterFramework.hpp"
+#include "Test.hpp"
+
+#include <catch.hpp>
+
+#include <memory>
+#include <string>
+
+using std::string;
+
+namespace parameterFramework
+{
+
+/** A parameter framework whose domain configurations hold one identical setting and one setting
+ * of their own. */
+struct DeduplicationPF : public ParameterFramework
+{
+    DeduplicationPF() : ParameterFramework{createConfig()} {}
+
+    /** @return the given byte count of the settings usage command output */
+    size_t getSettingsUsage(const string &counter)
+    {
+        std::unique_ptr<CommandHandlerInterface> commandHandler(createCommandHandler());
+        string usage;
+        REQUIRE(commandHandler->process("showSettingsUsage", {}, usage));
+
+        auto line = usage.find(counter + ": ");
+        REQUIRE(line != string::npos);
+
+        return std::stoul(usage.substr(line + counter.size() + 2));
+    }
+
+private:
+    static Config createConfig()
+    {
+        Config config;
+        config.instances = R"(<IntegerParameter Name="own" Size="8"/>
+                              <IntegerParameter Name="shared" Size="8"/>)";
+        config.domains = R"(<ConfigurableDomain Name="Domain">
+                                <Configurations>
+                                    <Configuration Name="First">
+                                        <CompoundRule Type="All"/>
+                                    </Configuration>
+                                    <Configuration Name="Second">
+                                        <CompoundRule Type="All"/>
+                                    </Configuration>
+                                    <Configuration Name="Third">
+                                        <CompoundRule Type="All"/>
+                                    </Configuration>
+                                </Configurations>
+                                <ConfigurableElements>
+                                    <ConfigurableElement Path="/test/test/own"/>
+                                    <ConfigurableElement Path="/test/test/shared"/>
+                                </ConfigurableElements>
+                                <Settings>
+                                    <Configuration Name="First">
+                                        <ConfigurableElement Path="/test/test/own">
+                                            <IntegerParameter Name="own">1</IntegerParameter>
+                                        </ConfigurableElement>
+                                        <ConfigurableElement Path="/test/test/shared">
+                                            <IntegerParameter Name="shared">5</IntegerParameter>
+                                        </ConfigurableElement>
+                                    </Configuration>
+                                    <Configuration Name="Second">
+                                        <ConfigurableElement Path="/test/test/own">
+                                            <IntegerParameter Name="own">2</IntegerParameter>
+                                        </ConfigurableElement>
+                                        <ConfigurableElement Path="/test/test/shared">
+                                            <IntegerParameter Name="shared">5</IntegerParameter>
+                                        </ConfigurableElement>
+                                    </Configuration>
+                                    <Configuration Name="Third">
+                                        <ConfigurableElement Path="/test/test/own">
+                                            <IntegerParameter Name="own">3</IntegerParameter>
+                                        </ConfigurableElement>
+                                        <ConfigurableElement Path="/test/test/shared">
+                                            <IntegerParameter Name="shared">5</IntegerParameter>
+                                        </ConfigurableElement>
+                                    </Configuration>
+                                </Settings>
+                            </ConfigurableDomain>)";
+        return config;
+    }
+};
+
+SCENARIO_METHOD(DeduplicationPF, "Configuration settings deduplication",
+                "[settings][deduplication]")
+{
+    GIVEN ("A parameter framework without settings deduplication") {
+        REQUIRE_NOTHROW(start());
+
+        THEN ("Each configuration holds its own settings") {
+            CHECK(getSettingsUsage("Stored") == getSettingsUsage("Settings"));
+        }
+    }
+    GIVEN ("A parameter framework sharing identical settings") {
+        REQUIRE_NOTHROW(setSettingsDeduplication(true));
+        CHECK(getSettingsDeduplication());
+        REQUIRE_NOTHROW(start());
+
+        size_t settings = getSettingsUsage("Settings");
+        size_t stored = getSettingsUsage("Stored");
+
+        THEN ("Identical settings are stored once") {
+            // "shared" is 5 in all three configurations
+            CHECK(stored == settings - 2);
+        }
+        THEN ("The policy can not be changed while running") {
+            CHECK_THROWS_AS(setSettingsDeduplication(false), Exception);
+        }
+        WHEN ("Modifying a shared setting of a configuration") {
+            REQUIRE_NOTHROW(setTuningMode(true));
+            string value = "6";
+            REQUIRE_NOTHROW(
+                setConfigurationParameter("Domain", "Second", "/test/test/shared", value));
+
+            THEN ("Only the modified configuration is changed") {
+                REQUIRE_NOTHROW(
+                    getConfigurationParameter("Domain", "Second", "/test/test/shared", value));
+                CHECK(value == "6");
+                REQUIRE_NOTHROW(
+                    getConfigurationParameter("Domain", "First", "/test/test/shared", value));
+                CHECK(value == "5");
+                CHECK(getSettingsUsage("Stored") == stored + 1);
+            }
+        }
+    }
+}
+} // namespace parameterFramework
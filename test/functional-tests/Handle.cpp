@@ -662,4 +662,109 @@ SCENARIO_METHOD(SettingsTestPF, "Handle Get/Set as various kinds", "[handler][dy
         }
     }
 }
+
+SCENARIO_METHOD(SettingsTestPF, "Typed handle Get/Set", "[handler][dynamic][typed]")
+{
+    GIVEN ("A typed handle of a scalar integer") {
+        auto integer = createTypedParameterHandle<uint32_t>("/test/test/parameter_block/integer");
+        string error;
+
+        THEN ("Setting it should be seen by element handles") {
+            CHECK(integer->set(111, error));
+            uint32_t back = 42;
+            CHECK_NOTHROW(ElementHandle(*this, "/test/test/parameter_block/integer")
+                              .getAsInteger(back));
+            CHECK(back == 111);
+        }
+        THEN ("Values set by element handles should be seen by it") {
+            CHECK_NOTHROW(
+                ElementHandle(*this, "/test/test/parameter_block/integer").setAsInteger(99));
+            uint32_t back = 42;
+            CHECK(integer->get(back, error));
+            CHECK(back == 99);
+        }
+        THEN ("Setting an out of range value should fail") {
+            CHECK_FALSE(integer->set(124, error));
+        }
+    }
+    GIVEN ("Typed handles of a fixed point and a bit parameter") {
+        auto fixedPoint =
+            createTypedParameterHandle<double>("/test/test/parameter_block/fix_point");
+        auto bit = createTypedParameterHandle<uint32_t>("/test/test/bit_block/six");
+        string error;
+
+        THEN ("Getting them back should give the values set") {
+            double fixedPointBack = 0;
+            uint32_t bitBack = 0;
+            CHECK(fixedPoint->set(2.25, error));
+            CHECK(bit->set(10, error));
+            CHECK(fixedPoint->get(fixedPointBack, error));
+            CHECK(bit->get(bitBack, error));
+            CHECK(fixedPointBack == 2.25);
+            CHECK(bitBack == 10);
+        }
+    }
+    WHEN ("Creating a typed handle of an array") {
+        THEN ("It should fail") {
+            CHECK_THROWS(
+                createTypedParameterHandle<int32_t>("/test/test/parameter_block/integer_array"));
+        }
+    }
+}
+
+SCENARIO_METHOD(SettingsTestPF, "Transaction of several writes", "[handler][dynamic][transaction]")
+{
+    ElementHandle integer(*this, "/test/test/parameter_block/integer");
+    ElementHandle intArray(*this, "/test/test/parameter_block/integer_array");
+    ElementHandle basicInteger(*this, "/test/test/integer");
+    auto transaction = createTransaction();
+    string error;
+
+    GIVEN ("Staged writes of several elements") {
+        REQUIRE_NOTHROW(integer.setAsInteger(transaction, 111));
+        REQUIRE_NOTHROW(intArray.setAsSignedIntegerArray(transaction, {-9, 8, -7, 6}));
+        REQUIRE_NOTHROW(basicInteger.setAsBytes(transaction, {0x62, 0}));
+        CHECK(transaction.getStagedWriteCount() == 3);
+
+        WHEN ("Committing them") {
+            REQUIRE(transaction.commit(error));
+            THEN ("All elements should have the values staged") {
+                uint32_t back = 0;
+                std::vector<int32_t> arrayBack;
+                CHECK_NOTHROW(integer.getAsInteger(back));
+                CHECK(back == 111);
+                CHECK_NOTHROW(intArray.getAsSignedIntegerArray(arrayBack));
+                CHECK(arrayBack == (std::vector<int32_t>{-9, 8, -7, 6}));
+                CHECK_NOTHROW(basicInteger.getAsInteger(back));
+                CHECK(back == 0x62);
+                CHECK(transaction.getStagedWriteCount() == 0);
+            }
+        }
+        WHEN ("One of them is out of range") {
+            uint32_t before = 0;
+            REQUIRE_NOTHROW(basicInteger.getAsInteger(before));
+            REQUIRE_NOTHROW(integer.setAsInteger(transaction, 1000));
+            THEN ("Commit should fail and leave all elements unchanged") {
+                CHECK_FALSE(transaction.commit(error));
+                uint32_t back = 0;
+                CHECK_NOTHROW(basicInteger.getAsInteger(back));
+                CHECK(back == before);
+                CHECK_NOTHROW(integer.getAsInteger(back));
+                CHECK(back != 111);
+            }
+        }
+        WHEN ("Discarding them") {
+            transaction.discard();
+            THEN ("Nothing should remain to commit") {
+                CHECK(transaction.getStagedWriteCount() == 0);
+            }
+        }
+    }
+    WHEN ("Staging a write of mismatching array length") {
+        THEN ("It should fail") {
+            CHECK_THROWS(intArray.setAsSignedIntegerArray(transaction, {0, 0}));
+            CHECK(transaction.getStagedWriteCount() == 0);
+        }
+    }
+}
 } // namespace parameterFramework
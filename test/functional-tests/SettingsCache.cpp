@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Config.hpp"
+#include "ParameterFramework.hpp"
+#include "Test.hpp"
+#include "TmpFile.hpp"
+
+#include <SelectionCriterionInterface.h>
+#include <SelectionCriterionTypeInterface.h>
+
+#include <catch.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using std::string;
+
+namespace parameterFramework
+{
+
+/** A parameter framework with a domain depending on a criterion, whose structure may vary by the
+ * maximum of its parameter. */
+struct SettingsCachePF : public ParameterFramework
+{
+    SettingsCachePF(const string &modeMax = "2") : ParameterFramework{createConfig(modeMax)}
+    {
+        string error;
+
+        auto modeType = createSelectionCriterionType(false);
+        REQUIRE(modeType->addValuePair(0, "idle", error));
+        REQUIRE(modeType->addValuePair(1, "call", error));
+        mMode = createSelectionCriterion("Mode", modeType);
+    }
+
+    string getValue(const string &path)
+    {
+        string value;
+        getParameter(path, value);
+        return value;
+    }
+
+    ISelectionCriterionInterface *mMode;
+
+private:
+    static Config createConfig(const string &modeMax)
+    {
+        Config config;
+        config.instances = R"(<IntegerParameter Name="mode" Size="8" Max=")" + modeMax + R"("/>)";
+        config.domains = R"(<ConfigurableDomain Name="ModeDomain">
+                                <Configurations>
+                                    <Configuration Name="Call">
+                                        <CompoundRule Type="All">
+                                            <SelectionCriterionRule SelectionCriterion="Mode"
+                                                MatchesWhen="Is" Value="call"/>
+                                        </CompoundRule>
+                                    </Configuration>
+                                    <Configuration Name="Default">
+                                        <CompoundRule Type="All"/>
+                                    </Configuration>
+                                </Configurations>
+                                <ConfigurableElements>
+                                    <ConfigurableElement Path="/test/test/mode"/>
+                                </ConfigurableElements>
+                                <Settings>
+                                    <Configuration Name="Call">
+                                        <ConfigurableElement Path="/test/test/mode">
+                                            <IntegerParameter Name="mode">1</IntegerParameter>
+                                        </ConfigurableElement>
+                                    </Configuration>
+                                    <Configuration Name="Default">
+                                        <ConfigurableElement Path="/test/test/mode">
+                                            <IntegerParameter Name="mode">0</IntegerParameter>
+                                        </ConfigurableElement>
+                                    </Configuration>
+                                </Settings>
+                            </ConfigurableDomain>)";
+        return config;
+    }
+};
+
+/** Logger keeping info logs only */
+struct InfoLogger : public CParameterMgrFullConnector::ILogger
+{
+    void info(const string &log) override { infos.push_back(log); }
+    void warning(const string &) override {}
+
+    bool logged(const string &pattern) const
+    {
+        return std::any_of(begin(infos), end(infos),
+                           [&](const string &log) { return log.find(pattern) != string::npos; });
+    }
+
+    std::vector<string> infos;
+};
+
+SCENARIO("Binary settings cache", "[settings][cache]")
+{
+    GIVEN ("A settings cache location holding no valid cache") {
+        utility::TmpFile cache("");
+        InfoLogger firstLogger;
+
+        SettingsCachePF first;
+        REQUIRE_NOTHROW(first.setSettingsCacheLocation(cache.getPath()));
+        CHECK(first.getSettingsCacheLocation() == cache.getPath());
+        first.setLogger(&firstLogger);
+        REQUIRE_NOTHROW(first.start());
+
+        THEN ("Settings are loaded from XML and cached") {
+            CHECK(not firstLogger.logged("loaded from settings cache"));
+            std::ifstream file(cache.getPath(), std::ios::binary);
+            string magic(4, '\0');
+            file.read(&magic[0], magic.size());
+            CHECK(magic == "PFWS");
+        }
+        THEN ("The location can not be changed while running") {
+            CHECK_THROWS_AS(first.setSettingsCacheLocation(""), Exception);
+        }
+        WHEN ("Starting a parameter framework with the same configuration") {
+            InfoLogger secondLogger;
+            SettingsCachePF second;
+            REQUIRE_NOTHROW(second.setSettingsCacheLocation(cache.getPath()));
+            second.setLogger(&secondLogger);
+            REQUIRE_NOTHROW(second.start());
+
+            THEN ("Settings are loaded from the cache") {
+                CHECK(secondLogger.logged("loaded from settings cache"));
+                CHECK(second.getValue("/test/test/mode") == "0");
+
+                string value;
+                REQUIRE_NOTHROW(second.getConfigurationParameter("ModeDomain", "Call",
+                                                                 "/test/test/mode", value));
+                CHECK(value == "1");
+            }
+            THEN ("Cached application rules are applied") {
+                second.mMode->setCriterionState(1);
+                second.applyConfigurations();
+
+                CHECK(second.getValue("/test/test/mode") == "1");
+            }
+        }
+        WHEN ("Starting a parameter framework with different criteria") {
+            InfoLogger secondLogger;
+            SettingsCachePF second;
+            string error;
+            auto extraType = second.createSelectionCriterionType(false);
+            REQUIRE(extraType->addValuePair(0, "off", error));
+            second.createSelectionCriterion("Extra", extraType);
+            REQUIRE_NOTHROW(second.setSettingsCacheLocation(cache.getPath()));
+            second.setLogger(&secondLogger);
+            REQUIRE_NOTHROW(second.start());
+
+            THEN ("The cache is stale and settings are loaded from XML") {
+                CHECK(secondLogger.logged("is stale"));
+                CHECK(not secondLogger.logged("loaded from settings cache"));
+                CHECK(second.getValue("/test/test/mode") == "0");
+            }
+        }
+        WHEN ("Starting a parameter framework with a different structure") {
+            InfoLogger secondLogger;
+            SettingsCachePF second("100");
+            REQUIRE_NOTHROW(second.setSettingsCacheLocation(cache.getPath()));
+            second.setLogger(&secondLogger);
+            REQUIRE_NOTHROW(second.start());
+
+            THEN ("The cache is stale and settings are loaded from XML") {
+                CHECK(secondLogger.logged("is stale"));
+                CHECK(not secondLogger.logged("loaded from settings cache"));
+                CHECK(second.getValue("/test/test/mode") == "0");
+            }
+        }
+    }
+}
+} // namespace parameterFramework
@@ -77,6 +77,15 @@ struct Config
 
     /** Subsystem type. Virtual by default. */
     std::string subsystemType = "Virtual";
+
+    /** Additional subsystems.
+     *
+     * Content appended to the configuration SystemClass xml node.
+     */
+    std::string subsystems;
+
+    /** Additional attributes of the configuration ParameterFrameworkConfiguration xml node. */
+    std::string frameworkAttributes;
 };
 
 } // namespace parameterFramework
@@ -47,11 +47,14 @@ public:
               format(mStructureTemplate, {{"type", config.subsystemType},
                                           {"instances", config.instances},
                                           {"components", config.components},
-                                          {"subsystemMapping", config.subsystemMapping}})),
+                                          {"subsystemMapping", config.subsystemMapping},
+                                          {"subsystems", config.subsystems}})),
           mDomainsFile(format(mDomainsTemplate, {{"domains", config.domains}})),
-          mConfigFile(format(mConfigTemplate, {{"structurePath", mStructureFile.getPath()},
-                                               {"domainsPath", mDomainsFile.getPath()},
-                                               {"plugins", toXml(config.plugins)}}))
+          mConfigFile(format(mConfigTemplate,
+                             {{"structurePath", mStructureFile.getPath()},
+                              {"domainsPath", mDomainsFile.getPath()},
+                              {"plugins", toXml(config.plugins)},
+                              {"frameworkAttributes", config.frameworkAttributes}}))
     {
     }
 
@@ -91,7 +94,8 @@ private:
     }
 
     const char *mConfigTemplate = R"(<?xml version='1.0' encoding='UTF-8'?>
-        <ParameterFrameworkConfiguration SystemClassName='test' TuningAllowed='true'>
+        <ParameterFrameworkConfiguration SystemClassName='test' TuningAllowed='true'
+                                         {frameworkAttributes}>
             <SubsystemPlugins>
                 {plugins}
             </SubsystemPlugins>
@@ -111,6 +115,7 @@ private:
                     {instances}
                 </InstanceDefinition>
             </Subsystem>
+            {subsystems}
         </SystemClass>
     )";
     const char *mDomainsTemplate = R"(<?xml version='1.0' encoding='UTF-8'?>
@@ -33,6 +33,7 @@
 #include "FailureWrapper.hpp"
 
 #include <ElementHandle.h>
+#include <ParameterTransaction.h>
 
 namespace parameterFramework
 {
@@ -101,6 +102,22 @@ public:
         mayFailCall(&EH::getAsSignedIntegerArray, value);
     }
 
+    /** Stage writes in a transaction, throw an exception on failure. @{ */
+    void setAsInteger(ParameterTransaction &transaction, uint32_t value) const
+    {
+        stage(&ParameterTransaction::setAsInteger, transaction, value);
+    }
+    void setAsSignedIntegerArray(ParameterTransaction &transaction,
+                                 const std::vector<int32_t> &value) const
+    {
+        stage(&ParameterTransaction::setAsSignedIntegerArray, transaction, value);
+    }
+    void setAsBytes(ParameterTransaction &transaction, const std::vector<uint8_t> &value) const
+    {
+        stage(&ParameterTransaction::setAsBytes, transaction, value);
+    }
+    /** @} */
+
     std::string getStructureAsXML() const { return mayFailGet(&EH::getStructureAsXML); }
 
     std::string getAsXML() const { return mayFailGet(&EH::getAsXML); }
@@ -113,6 +130,17 @@ public:
         return settings;
     }
     void setAsBytes(const std::vector<uint8_t> &settings) { mayFailSet(&EH::setAsBytes, settings); }
+
+private:
+    template <class Value, class Arg>
+    void stage(bool (ParameterTransaction::*method)(const EH &, Value, std::string &),
+               ParameterTransaction &transaction, const Arg &value) const
+    {
+        std::string error;
+        if (not(transaction.*method)(*this, value, error)) {
+            throw Exception(error);
+        }
+    }
 };
 
 } // namespace parameterFramework
@@ -75,6 +75,8 @@ public:
      * can not fail (no failure to throw).
      * @{ */
     using PF::applyConfigurations;
+    using PF::createSelectionCriterionType;
+    using PF::createSelectionCriterion;
     using PF::getFailureOnMissingSubsystem;
     using PF::getFailureOnFailedSettingsLoad;
     using PF::getForceNoRemoteInterface;
@@ -82,12 +84,19 @@ public:
     using PF::getSchemaUri;
     using PF::setSchemaUri;
     using PF::getValidateSchemasOnStart;
+    using PF::getParallelApply;
+    using PF::getDecisionTable;
+    using PF::getSettingsDeduplication;
+    using PF::getSettingsCacheLocation;
+    using PF::getAsynchronousSync;
+    using PF::getSyncCompletion;
     using PF::isValueSpaceRaw;
     using PF::isOutputRawFormatHex;
     using PF::isTuningModeOn;
     using PF::isAutoSyncOn;
     using PF::setLogger;
     using PF::createCommandHandler;
+    using PF::createTransaction;
     /** @} */
 
     /** Wrap PF::setValidateSchemasOnStart to throw an exception on failure. */
@@ -102,6 +111,30 @@ public:
         mayFailCall(&PPF::setFailureOnFailedSettingsLoad, fail);
     }
 
+    /** Wrap PF::setParallelApply to throw an exception on failure. */
+    void setParallelApply(bool parallel) { mayFailCall(&PPF::setParallelApply, parallel); }
+
+    /** Wrap PF::setDecisionTable to throw an exception on failure. */
+    void setDecisionTable(bool enable) { mayFailCall(&PPF::setDecisionTable, enable); }
+
+    /** Wrap PF::setSettingsDeduplication to throw an exception on failure. */
+    void setSettingsDeduplication(bool deduplicate)
+    {
+        mayFailCall(&PPF::setSettingsDeduplication, deduplicate);
+    }
+
+    /** Wrap PF::setSettingsCacheLocation to throw an exception on failure. */
+    void setSettingsCacheLocation(const std::string &location)
+    {
+        mayFailCall(&PPF::setSettingsCacheLocation, location);
+    }
+
+    /** Wrap PF::setAsynchronousSync to throw an exception on failure. */
+    void setAsynchronousSync(bool asynchronous)
+    {
+        mayFailCall(&PPF::setAsynchronousSync, asynchronous);
+    }
+
     /** Wrap PF::setFailureOnMissingSubsystem to throw an exception on failure. */
     void setFailureOnMissingSubsystem(bool fail)
     {
@@ -146,6 +179,21 @@ public:
         mayFailCall(&PF::accessConfigurationValue, domain, configuration, path, value, true);
     }
 
+    /** Wrap PF::setApplicationRule to throw an exception on failure. */
+    void setApplicationRule(const std::string &domain, const std::string &configuration,
+                            const std::string &rule)
+    {
+        mayFailCall(&PF::setApplicationRule, domain, configuration, rule);
+    }
+
+    /** Wrap PF::createTypedParameterHandle to throw an exception on failure. */
+    template <class T>
+    std::unique_ptr<TypedParameterHandle<T>> createTypedParameterHandle(const std::string &path)
+    {
+        return std::unique_ptr<TypedParameterHandle<T>>{
+            mayFailCall(&PPF::createTypedParameterHandle<T>, path)};
+    }
+
     /** Wrap PF::accessConfigurationValue in "get" mode (and rename it) to throw an
      * exception on failure
      */
@@ -155,6 +203,14 @@ public:
         mayFailCall(&PF::accessConfigurationValue, domain, configuration, path, value, false);
     }
 
+    /** Wrap PF::exportDomainsXml to a string to throw an exception on failure. */
+    std::string exportDomainsXml(bool withSettings) const
+    {
+        std::string xml;
+        mayFailCall(&PF::exportDomainsXml, xml, withSettings, false);
+        return xml;
+    }
+
 private:
     /** Create an unwrapped element handle.
      *
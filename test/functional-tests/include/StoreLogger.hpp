@@ -68,6 +68,11 @@ public:
     }
     void info(const std::string &strLog) override { logs.push_back({Log::Level::info, strLog}); }
 
+    bool isInfoEnabled() const override { return infoEnabled; }
+
+    /** Whether the PF should log infos at all */
+    bool infoEnabled = true;
+
     const Logs &getLogs() const { return logs; }
 
     Logs filter(Log::Level level) const
@@ -29,6 +29,7 @@
  */
 
 #include "IntrospectionEntryPoint.h"
+#include "IntrospectionSubsystem.h"
 #include "IntrospectionSubsystemObject.h"
 
 namespace parameterFramework
@@ -40,5 +41,25 @@ bool getParameterValue()
 {
     return SubsystemObject::getSingletonInstanceValue();
 }
+
+size_t getSendToHWCount()
+{
+    return SubsystemObject::getSingletonInstanceSendCount();
+}
+
+size_t getSyncBatchCount()
+{
+    return Subsystem::getSyncBatchCount();
+}
+
+void setSendToHWFailure(bool failure)
+{
+    SubsystemObject::setSendToHWFailure(failure);
+}
+
+void setSyncDelay(size_t milliseconds)
+{
+    Subsystem::setSyncDelay(milliseconds);
+}
 } // namespace introspectionSubsystem
 } // namespace parameterFramework
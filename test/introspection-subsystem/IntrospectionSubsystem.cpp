@@ -31,6 +31,8 @@
 #include "IntrospectionSubsystem.h"
 #include "IntrospectionSubsystemObject.h"
 #include <SubsystemObjectFactory.h>
+#include <chrono>
+#include <thread>
 
 namespace parameterFramework
 {
@@ -41,5 +43,17 @@ Subsystem::Subsystem(const std::string &name, core::log::Logger &logger) : base(
 {
     addSubsystemObjectFactory(new TSubsystemObjectFactory<SubsystemObject>("Object", 0));
 }
+
+std::atomic<std::size_t> Subsystem::mSyncBatchCount{0};
+std::atomic<std::size_t> Subsystem::mSyncDelay{0};
+
+bool Subsystem::syncSubsystemObjects(const std::vector<CSubsystemObject *> &objects, bool bBack,
+                                     std::string &error)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(mSyncDelay));
+
+    ++mSyncBatchCount;
+    return base::syncSubsystemObjects(objects, bBack, error);
+}
 } // namespace introspectionSubsystem
 } // namespace parameterFramework
@@ -30,6 +30,10 @@
 #pragma once
 
 #include <Subsystem.h>
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <vector>
 
 namespace parameterFramework
 {
@@ -43,8 +47,21 @@ class Subsystem : public CSubsystem
 public:
     Subsystem(const std::string &name, core::log::Logger &logger);
 
+    /** @return the number of batches synchronized by any instance of this subsystem */
+    static std::size_t getSyncBatchCount() { return mSyncBatchCount; }
+
+    /** Make batch synchronizations of any instance last at least the given duration */
+    static void setSyncDelay(std::size_t milliseconds) { mSyncDelay = milliseconds; }
+
 private:
     using base = CSubsystem;
+
+    bool syncSubsystemObjects(const std::vector<CSubsystemObject *> &objects, bool bBack,
+                              std::string &error) override;
+
+    /** Set by the tests and updated by synchronizations, which may run from a subsystem thread */
+    static std::atomic<std::size_t> mSyncBatchCount;
+    static std::atomic<std::size_t> mSyncDelay;
 };
 } // namespace introspectionSubsystem
 } // namespace parameterFramework
@@ -38,6 +38,7 @@ namespace introspectionSubsystem
 {
 
 const SubsystemObject *SubsystemObject::mSingletonInstance = nullptr;
+std::atomic<bool> SubsystemObject::mSendToHWFailure{false};
 
 /* Helper function */
 const CParameterType *geParameterType(CInstanceConfigurableElement *element)
@@ -68,8 +69,14 @@ SubsystemObject::~SubsystemObject()
     unregisterInstance(*this);
 }
 
-bool SubsystemObject::sendToHW(std::string & /*error*/)
+bool SubsystemObject::sendToHW(std::string &error)
 {
+    if (mSendToHWFailure) {
+
+        error = "Unable to send the parameter to the hardware";
+        return false;
+    }
+    ++mSendCount;
     blackboardRead(&mParameter, parameterSize);
     return true;
 }
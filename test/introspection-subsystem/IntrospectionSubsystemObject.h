@@ -31,6 +31,7 @@
 
 #include <SubsystemObject.h>
 #include <AlwaysAssert.hpp>
+#include <atomic>
 #include <string>
 
 class CMappingContext;
@@ -58,6 +59,15 @@ public:
         return mSingletonInstance->mParameter;
     }
 
+    static std::size_t getSingletonInstanceSendCount()
+    {
+        ALWAYS_ASSERT(mSingletonInstance != nullptr, "Singleton value has not been registered");
+        return mSingletonInstance->mSendCount;
+    }
+
+    /** Make sendToHW() of any instance fail, or not */
+    static void setSendToHWFailure(bool failure) { mSendToHWFailure = failure; }
+
 private:
     using base = CSubsystemObject;
 
@@ -83,7 +93,11 @@ private:
 
     static const SubsystemObject *mSingletonInstance;
 
+    /** Set by the tests, read by synchronizations which may run from a subsystem thread */
+    static std::atomic<bool> mSendToHWFailure;
+
     bool mParameter;
+    std::size_t mSendCount{0};
 };
 } // namespace introspectionSubsystem
 } // namespace parameterFramework
@@ -31,11 +31,31 @@
 
 #include "introspection_subsystem_export.h"
 
+#include <cstddef>
+
 namespace parameterFramework
 {
 namespace introspectionSubsystem
 {
 
 INTROSPECTION_SUBSYSTEM_EXPORT bool getParameterValue();
+
+/** @return the number of times the parameter has been sent to the "hardware" */
+INTROSPECTION_SUBSYSTEM_EXPORT size_t getSendToHWCount();
+
+/** @return the number of object batches synchronized by the subsystem */
+INTROSPECTION_SUBSYSTEM_EXPORT size_t getSyncBatchCount();
+
+/** Make the parameter fail (or not) to be sent to the "hardware"
+ *
+ * @param[in] failure true to make sending fail, false to make it succeed (default)
+ */
+INTROSPECTION_SUBSYSTEM_EXPORT void setSendToHWFailure(bool failure);
+
+/** Make object batches take (or not) some time to be synchronized
+ *
+ * @param[in] milliseconds the minimum duration of a batch synchronization, 0 by default
+ */
+INTROSPECTION_SUBSYSTEM_EXPORT void setSyncDelay(size_t milliseconds);
 } // namespace introspectionSubsystem
 } // namespace parameterFramework
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "CompoundRule.h"
+#include "RuleParser.h"
+#include "RuleProgram.h"
+#include "SelectionCriteriaDefinition.h"
+#include "SelectionCriterion.h"
+#include "SelectionCriterionType.h"
+#include <log/Logger.h>
+
+#define CATCH_CONFIG_MAIN // This tells Catch to provide a main()
+#include <catch.hpp>
+
+#include <memory>
+#include <string>
+
+using std::string;
+
+/** Exclusive "Mode" criterion (a, b, c) and inclusive "Route" criterion (x, y, z) */
+struct Criteria
+{
+    Criteria() : modeType(false), routeType(true)
+    {
+        string error;
+        REQUIRE(modeType.addValuePair(0, "a", error));
+        REQUIRE(modeType.addValuePair(1, "b", error));
+        REQUIRE(modeType.addValuePair(2, "c", error));
+        REQUIRE(routeType.addValuePair(1, "x", error));
+        REQUIRE(routeType.addValuePair(2, "y", error));
+        REQUIRE(routeType.addValuePair(4, "z", error));
+
+        mode = definition.createSelectionCriterion("Mode", &modeType, logger);
+        route = definition.createSelectionCriterion("Route", &routeType, logger);
+    }
+
+    std::unique_ptr<CCompoundRule> parse(const string &rule)
+    {
+        CRuleParser parser(rule, &definition);
+        string error;
+
+        INFO("Rule: " << rule);
+        REQUIRE(parser.parse(nullptr, error));
+
+        return std::unique_ptr<CCompoundRule>(parser.grabRootRule());
+    }
+
+    /** Check that the program evaluates as the rule tree, whatever the criterion states */
+    void checkAllStates(const CRuleProgram &program, const CRule &rule)
+    {
+        for (int modeState = 0; modeState < 3; ++modeState) {
+            for (int routeState = 0; routeState < 8; ++routeState) {
+
+                mode->setCriterionState(modeState);
+                route->setCriterionState(routeState);
+
+                INFO("Rule: " << rule.dump() << ", Mode: " << modeState
+                              << ", Route: " << routeState);
+                CHECK(program.matches() == rule.matches());
+                CHECK(program.matches(rule) == rule.matches());
+            }
+        }
+    }
+
+    struct NullLogger : core::log::ILogger
+    {
+        void info(const string &) override {}
+        void warning(const string &) override {}
+    } nullLogger;
+    core::log::Logger logger{nullLogger};
+
+    CSelectionCriterionType modeType;
+    CSelectionCriterionType routeType;
+    CSelectionCriteriaDefinition definition;
+    CSelectionCriterion *mode;
+    CSelectionCriterion *route;
+};
+
+SCENARIO_METHOD(Criteria, "Compiled rules evaluate as rule trees", "[rule]")
+{
+    const char *rules[] = {
+        "All{Mode Is b}",
+        "Any{Mode Is a, Mode Is c}",
+        "All{Mode IsNot b, Route Excludes y}",
+        "Any{Route Includes x, All{Mode Is b, Route Excludes z}}",
+        "All{Any{Mode Is a, Route Includes y}, Any{Mode IsNot c, Route Excludes x}, "
+        "Route Includes z}",
+        "Any{All{Any{Mode Is c}, Route Excludes x}, Mode IsNot a}",
+        "All{}",
+        "Any{}",
+        "Any{Any{}, Route Includes y}"};
+
+    for (const char *rule : rules) {
+
+        GIVEN ("The rule " << rule) {
+            auto pRule = parse(rule);
+            CRuleProgram program;
+
+            WHEN ("Compiling it") {
+                program.compile(*pRule);
+
+                THEN ("The program evaluates as the rule tree") {
+                    CHECK_FALSE(program.empty());
+                    checkAllStates(program, *pRule);
+                }
+            }
+        }
+    }
+}
+
+SCENARIO_METHOD(Criteria, "Rule recompilation", "[rule]")
+{
+    GIVEN ("A program compiled from a rule") {
+        auto pFirstRule = parse("Any{Mode Is a, Route Includes x}");
+        CRuleProgram program;
+        program.compile(*pFirstRule);
+
+        WHEN ("Compiling another rule") {
+            auto pSecondRule = parse("All{Mode IsNot a, Route Excludes x}");
+            program.compile(*pSecondRule);
+
+            THEN ("The program evaluates as the new rule") {
+                checkAllStates(program, *pSecondRule);
+            }
+        }
+        WHEN ("Clearing the program") {
+            program.clear();
+
+            THEN ("It is empty") {
+                CHECK(program.empty());
+            }
+        }
+    }
+}
+
+SCENARIO_METHOD(Criteria, "Evaluation of rules not compiled yet", "[rule]")
+{
+    GIVEN ("A rule and an empty program") {
+        auto pRule = parse("Any{All{Mode Is b, Route Includes y}, Route Excludes z}");
+        CRuleProgram program;
+        REQUIRE(program.empty());
+
+        THEN ("The rule tree is evaluated instead") {
+            for (int modeState = 0; modeState < 3; ++modeState) {
+                for (int routeState = 0; routeState < 8; ++routeState) {
+
+                    mode->setCriterionState(modeState);
+                    route->setCriterionState(routeState);
+
+                    INFO("Mode: " << modeState << ", Route: " << routeState);
+                    CHECK(program.matches(*pRule) == pRule->matches());
+                }
+            }
+        }
+    }
+}
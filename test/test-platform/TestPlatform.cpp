@@ -125,6 +125,46 @@ bool CTestPlatform::run(std::string &strError)
         &CTestPlatform::getter<&CParameterMgrPlatformConnector::getValidateSchemasOnStart>, 0, "",
         "Get policy for schema validation based on .xsd files.");
 
+    commandHandler.addCommandParser(
+        "setParallelApply",
+        &CTestPlatform::setter<&CParameterMgrPlatformConnector::setParallelApply>, 1,
+        "true|false", "Set policy for applying domains of distinct subsystems concurrently "
+                      "(false by default).");
+    commandHandler.addCommandParser(
+        "getParallelApply",
+        &CTestPlatform::getter<&CParameterMgrPlatformConnector::getParallelApply>, 0, "",
+        "Get policy for applying domains of distinct subsystems concurrently.");
+
+    commandHandler.addCommandParser(
+        "setDecisionTable",
+        &CTestPlatform::setter<&CParameterMgrPlatformConnector::setDecisionTable>, 1,
+        "true|false", "Set policy for memorizing applicable configurations per criterion "
+                      "states (false by default).");
+    commandHandler.addCommandParser(
+        "getDecisionTable",
+        &CTestPlatform::getter<&CParameterMgrPlatformConnector::getDecisionTable>, 0, "",
+        "Get policy for memorizing applicable configurations per criterion states.");
+
+    commandHandler.addCommandParser(
+        "setSettingsDeduplication",
+        &CTestPlatform::setter<&CParameterMgrPlatformConnector::setSettingsDeduplication>, 1,
+        "true|false", "Set policy for sharing storage of identical configuration settings "
+                      "(false by default).");
+    commandHandler.addCommandParser(
+        "getSettingsDeduplication",
+        &CTestPlatform::getter<&CParameterMgrPlatformConnector::getSettingsDeduplication>, 0, "",
+        "Get policy for sharing storage of identical configuration settings.");
+
+    commandHandler.addCommandParser(
+        "setAsynchronousSync",
+        &CTestPlatform::setter<&CParameterMgrPlatformConnector::setAsynchronousSync>, 1,
+        "true|false", "Set policy for synchronizing subsystems from their own thread "
+                      "(false by default).");
+    commandHandler.addCommandParser(
+        "getAsynchronousSync",
+        &CTestPlatform::getter<&CParameterMgrPlatformConnector::getAsynchronousSync>, 0, "",
+        "Get policy for synchronizing subsystems from their own thread.");
+
     commandHandler.addCommandParser("getSchemaUri", &CTestPlatform::getSchemaUri, 0, "",
                                     "Get the directory where schemas can be found.");
     commandHandler.addCommandParser("setSchemaUri", &CTestPlatform::setSchemaUri, 1, "<directory>",
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "NonCopyable.hpp"
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+
+namespace utility
+{
+
+/** Readers-writer lock, standing in for C++17 std::shared_mutex
+ *
+ * Writers have priority: once one is waiting, newcomer readers wait too so that a steady flow of
+ * readers can not starve writers.
+ * Exclusive ownership is meant to be taken through std::lock_guard, shared ownership through
+ * SharedLock.
+ */
+class SharedMutex : private NonCopyable
+{
+public:
+    void lock()
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+
+        ++mWaitingWriterCount;
+        mWriterCondition.wait(lock, [this] { return not mWriting and mReaderCount == 0; });
+        --mWaitingWriterCount;
+
+        mWriting = true;
+    }
+
+    void unlock()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+
+            mWriting = false;
+        }
+        // Waiting writers are preferred by readers themselves, wake everybody
+        mWriterCondition.notify_one();
+        mReaderCondition.notify_all();
+    }
+
+    void lock_shared()
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+
+        mReaderCondition.wait(lock,
+                              [this] { return not mWriting and mWaitingWriterCount == 0; });
+        ++mReaderCount;
+    }
+
+    void unlock_shared()
+    {
+        bool bLastReader;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+
+            bLastReader = --mReaderCount == 0;
+        }
+        if (bLastReader) {
+
+            mWriterCondition.notify_one();
+        }
+    }
+
+private:
+    std::mutex mMutex;
+    std::condition_variable mReaderCondition;
+    std::condition_variable mWriterCondition;
+
+    size_t mReaderCount{0};
+    size_t mWaitingWriterCount{0};
+    bool mWriting{false};
+};
+
+/** Shared ownership of a SharedMutex for the lifetime of the object, standing in for C++14
+ * std::shared_lock
+ */
+class SharedLock : private NonCopyable
+{
+public:
+    explicit SharedLock(SharedMutex &mutex) : mMutex(mutex) { mMutex.lock_shared(); }
+    ~SharedLock() { mMutex.unlock_shared(); }
+
+private:
+    SharedMutex &mMutex;
+};
+
+} // namespace utility
@@ -62,4 +62,17 @@ bool isHexadecimal(const string &strValue)
     return (strValue.compare(0, 2, "0x") == 0) or (strValue.compare(0, 2, "0X") == 0);
 }
 
+uint64_t digest(const void *pvData, size_t size)
+{
+    const uint8_t *data = static_cast<const uint8_t *>(pvData);
+    uint64_t result = 14695981039346656037ULL;
+
+    for (size_t index = 0; index < size; ++index) {
+
+        result ^= data[index];
+        result *= 1099511628211ULL;
+    }
+    return result;
+}
+
 } // namespace utility
@@ -30,6 +30,8 @@
 
 #pragma once
 
+#include <cstdint>
+#include <cstddef>
 #include <string>
 #include <list>
 #include <map>
@@ -109,4 +111,14 @@ void appendTitle(std::string &strTo, const std::string &strTitle);
  */
 bool isHexadecimal(const std::string &strValue);
 
+/**
+ * Compute a non cryptographic digest (64-bit FNV-1a) of a byte sequence.
+ *
+ * @param[in] pvData the bytes to digest
+ * @param[in] size the number of bytes
+ *
+ * @return the digest
+ */
+uint64_t digest(const void *pvData, size_t size);
+
 } // namespace utility
@@ -31,6 +31,7 @@
 #pragma once
 
 #include <limits>
+#include <locale>
 #include <sstream>
 #include <string>
 #include <stdint.h>
@@ -114,6 +115,90 @@ struct ConvertionAllowedVia<signed char, int> : std::true_type
 {
 };
 
+/* Integer parsing, without the cost of a stream construction.
+ *
+ * Accepts exactly what stream extraction of the type accepts in the cases convertTo lets through:
+ * an optional sign followed by decimal digits, or "0x" followed by hexadecimal digits. Out of
+ * range values are rejected. */
+template <typename T>
+static inline bool parseNumber(const std::string &str, T &result, std::true_type /*isInteger*/)
+{
+    using Unsigned = typename std::make_unsigned<T>::type;
+
+    const char *current = str.c_str();
+    const char *end = current + str.size();
+    unsigned base = 10;
+    bool negative = false;
+
+    if (str.compare(0, 2, "0x") == 0) {
+        base = 16;
+        current += 2;
+    } else if (current != end && (*current == '+' || *current == '-')) {
+        negative = *current == '-';
+        ++current;
+    }
+    if (current == end) {
+        return false;
+    }
+
+    Unsigned limit = static_cast<Unsigned>(std::numeric_limits<T>::max());
+
+    /* Magnitude of the minimum of signed types is one more than the maximum */
+    if (negative && std::numeric_limits<T>::is_signed) {
+        ++limit;
+    }
+    Unsigned magnitude = 0;
+
+    for (; current != end; ++current) {
+
+        unsigned digit;
+
+        if (*current >= '0' && *current <= '9') {
+            digit = *current - '0';
+        } else if (base == 16 && *current >= 'a' && *current <= 'f') {
+            digit = *current - 'a' + 10;
+        } else if (base == 16 && *current >= 'A' && *current <= 'F') {
+            digit = *current - 'A' + 10;
+        } else {
+            return false;
+        }
+        if (magnitude > (limit - digit) / base) {
+            /* Out of range */
+            return false;
+        }
+        magnitude = static_cast<Unsigned>(magnitude * base + digit);
+    }
+
+    /* Negate without overflowing on the minimum */
+    result = negative && magnitude != 0 ? static_cast<T>(-static_cast<T>(magnitude - 1) - 1)
+                                        : static_cast<T>(magnitude);
+    return true;
+}
+
+/* Floating point parsing, through a stream reused by the thread.
+ *
+ * The classic locale is used, so that parsing does not depend on the global locale. */
+template <typename T>
+static inline bool parseNumber(const std::string &str, T &result, std::false_type /*isInteger*/)
+{
+    struct ClassicStream : std::istringstream
+    {
+        ClassicStream() { imbue(std::locale::classic()); }
+    };
+    static thread_local ClassicStream stream;
+
+    /* Conversion undefined for non integers */
+    if (str.compare(0, 2, "0x") == 0) {
+        return false;
+    }
+
+    stream.clear();
+    stream.str(str);
+    stream >> result;
+
+    return stream.eof() && !stream.fail() && !stream.bad();
+}
+
 template <typename T>
 static inline bool convertTo(const std::string &str, T &result)
 {
@@ -122,33 +207,19 @@ static inline bool convertTo(const std::string &str, T &result)
      * with this type, thus that the result is undefined. */
     static_assert(ConvertionAllowed<T>::value, "convertTo does not support this conversion");
 
-    if (str.find_first_of(std::string("\r\n\t\v ")) != std::string::npos) {
+    if (str.find_first_of("\r\n\t\v ") != std::string::npos) {
         return false;
     }
 
     /* Check for a '-' in string. If type is unsigned and a - is found, the
      * parsing fails. This is made necessary because "-1" is read as 65535 for
      * uint16_t, for example */
-    if (str.find("-") != std::string::npos && !std::numeric_limits<T>::is_signed) {
+    if (str.find('-') != std::string::npos && !std::numeric_limits<T>::is_signed) {
         return false;
     }
 
-    std::stringstream ss(str);
-
-    /* Sadly, the stream conversion does not handle hexadecimal format, thus
-     * check is done manually */
-    if (str.substr(0, 2) == "0x") {
-        if (std::numeric_limits<T>::is_integer) {
-            ss >> std::hex >> result;
-        } else {
-            /* Conversion undefined for non integers */
-            return false;
-        }
-    } else {
-        ss >> result;
-    }
-
-    return ss.eof() && !ss.fail() && !ss.bad();
+    return parseNumber(str, result,
+                       std::integral_constant<bool, std::numeric_limits<T>::is_integer>());
 }
 
 template <typename T, typename Via>
@@ -30,6 +30,7 @@
 
 #include "Utility.h"
 #include "BinaryCopy.hpp"
+#include "convert.hpp"
 
 #include <catch.hpp>
 #include <functional>
@@ -220,4 +221,49 @@ SCENARIO("binaryCopy bit exactness")
     }
 }
 
+SCENARIO("convertTo integers")
+{
+    GIVEN ("Valid decimal and hexadecimal representations") {
+        int32_t signedValue;
+        uint16_t unsignedValue;
+        uint8_t byteValue;
+
+        CHECK((convertTo("-2147483648", signedValue) && signedValue == INT32_MIN));
+        CHECK((convertTo("+2147483647", signedValue) && signedValue == INT32_MAX));
+        CHECK((convertTo("0x7fffFFFF", signedValue) && signedValue == INT32_MAX));
+        CHECK((convertTo("007", signedValue) && signedValue == 7));
+        CHECK((convertTo("-0", signedValue) && signedValue == 0));
+        CHECK((convertTo("65535", unsignedValue) && unsignedValue == 65535));
+        CHECK((convertTo("0xFF", byteValue) && byteValue == 255));
+    }
+    GIVEN ("Invalid or out of range representations") {
+        int32_t signedValue;
+        uint16_t unsignedValue;
+        uint8_t byteValue;
+
+        for (auto str : {"", "+", "-", "0x", "0X1", "0x-1", "-0x1", "1a", " 1", "1 ", "--1",
+                         "2147483648", "-2147483649", "0x80000000", "1.5"}) {
+            CAPTURE(str);
+            CHECK(not convertTo(str, signedValue));
+        }
+        for (auto str : {"65536", "-1", "-0", "0x10000"}) {
+            CAPTURE(str);
+            CHECK(not convertTo(str, unsignedValue));
+        }
+        CHECK(not convertTo("256", byteValue));
+    }
+}
+
+SCENARIO("convertTo floating points")
+{
+    double value;
+
+    CHECK((convertTo("-1.5e3", value) && value == -1500));
+    CHECK((convertTo(".5", value) && value == 0.5));
+    for (auto str : {"", "0x1", "1e", "1,5", "inf", "nan", "1e400", " 1"}) {
+        CAPTURE(str);
+        CHECK(not convertTo(str, value));
+    }
+}
+
 } // namespace utility
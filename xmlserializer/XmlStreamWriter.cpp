@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "XmlStreamWriter.h"
+#include "XmlMemoryDocSource.h"
+#include <libxml/tree.h>
+#include <libxml/xmlwriter.h>
+#include <exception>
+
+CXmlStreamWriter::CXmlStreamWriter(std::ostream &output)
+    : _pOutputBuffer(xmlOutputBufferCreateIO(write, close, &output, nullptr)),
+      _pWriter(_pOutputBuffer != nullptr ? xmlNewTextWriter(_pOutputBuffer) : nullptr)
+{
+    if (_pWriter == nullptr && _pOutputBuffer != nullptr) {
+
+        xmlOutputBufferClose(_pOutputBuffer);
+        _pOutputBuffer = nullptr;
+    }
+}
+
+CXmlStreamWriter::~CXmlStreamWriter()
+{
+    // Also closes the output buffer
+    if (_pWriter != nullptr) {
+
+        xmlFreeTextWriter(_pWriter);
+    }
+}
+
+int CXmlStreamWriter::write(void *pOutput, const char *pcBuffer, int iLength)
+{
+    std::ostream &output = *static_cast<std::ostream *>(pOutput);
+
+    // Exceptions must not cross libxml2 frames, report the failure instead
+    try {
+        output.write(pcBuffer, iLength);
+    } catch (std::exception &) {
+        return -1;
+    }
+    return output.good() ? iLength : -1;
+}
+
+int CXmlStreamWriter::close(void * /*pOutput*/)
+{
+    // The stream belongs to the caller
+    return 0;
+}
+
+bool CXmlStreamWriter::checkWrite(int iStatus, CXmlSerializingContext &serializingContext)
+{
+    if (iStatus < 0) {
+
+        serializingContext.setError("Unable to write XML document to the output stream");
+
+        return false;
+    }
+    return true;
+}
+
+bool CXmlStreamWriter::startDocument(const std::string &strRootElementType,
+                                     CXmlSerializingContext &serializingContext)
+{
+    if (_pWriter == nullptr) {
+
+        serializingContext.setError("Unable to create XML writer");
+
+        return false;
+    }
+    return checkWrite(xmlTextWriterStartDocument(_pWriter, nullptr, "UTF-8", nullptr),
+                      serializingContext) &&
+           checkWrite(xmlTextWriterStartElement(_pWriter, BAD_CAST strRootElementType.c_str()),
+                      serializingContext);
+}
+
+bool CXmlStreamWriter::setRootAttribute(const std::string &strName, const std::string &strValue,
+                                        CXmlSerializingContext &serializingContext)
+{
+    return checkWrite(xmlTextWriterWriteAttribute(_pWriter, BAD_CAST strName.c_str(),
+                                                  BAD_CAST strValue.c_str()),
+                      serializingContext);
+}
+
+bool CXmlStreamWriter::writeChild(const IXmlSource &xmlSource, const std::string &strElementType,
+                                  CXmlSerializingContext &serializingContext)
+{
+    CXmlMemoryDocSource childSource(&xmlSource, false, strElementType);
+
+    if (!childSource.populate(serializingContext)) {
+
+        return false;
+    }
+
+    // Closes the root start tag if need be, then indents as a formatted document dump would
+    if (!checkWrite(xmlTextWriterWriteRaw(_pWriter, BAD_CAST "\n  "), serializingContext)) {
+
+        return false;
+    }
+    _bHasChildren = true;
+
+    // The writer has no buffer of its own, the child can be dumped to its output straight away
+    xmlNodeDumpOutput(_pOutputBuffer, childSource.getDoc(),
+                      xmlDocGetRootElement(childSource.getDoc()), 1, 1, "UTF-8");
+
+    return checkWrite(xmlOutputBufferFlush(_pOutputBuffer), serializingContext);
+}
+
+bool CXmlStreamWriter::endDocument(CXmlSerializingContext &serializingContext)
+{
+    if (_bHasChildren &&
+        !checkWrite(xmlTextWriterWriteRaw(_pWriter, BAD_CAST "\n"), serializingContext)) {
+
+        return false;
+    }
+    return checkWrite(xmlTextWriterEndDocument(_pWriter), serializingContext) &&
+           checkWrite(xmlTextWriterFlush(_pWriter), serializingContext);
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "XmlSource.h"
+#include "XmlSerializingContext.h"
+
+#include "NonCopyable.hpp"
+
+#include <ostream>
+#include <string>
+
+struct _xmlTextWriter;
+struct _xmlOutputBuffer;
+
+/**
+  * Writes a XML document to a std::ostream one child of its root element at a time.
+  *
+  * Contrary to CXmlMemoryDocSource, the whole document tree is never held in memory:
+  * each child is built, written and released in turn. Memory usage is thus bounded by
+  * the size of the biggest child rather than by the size of the document.
+  * The output is formatted the same way CXmlStreamDocSink formats a whole document.
+  */
+class CXmlStreamWriter : private utility::NonCopyable
+{
+public:
+    /** Constructor
+      *
+      * @param[out] output the stream the document is written to
+      */
+    CXmlStreamWriter(std::ostream &output);
+    ~CXmlStreamWriter();
+
+    /** Write the XML declaration and open the root element
+      *
+      * @param[in] strRootElementType the name of the root element
+      * @param[out] serializingContext is used as error output
+      *
+      * @return false if any error occurs
+      */
+    bool startDocument(const std::string &strRootElementType,
+                       CXmlSerializingContext &serializingContext);
+
+    /** Set an attribute of the root element, before any child is written
+      *
+      * @return false if any error occurs
+      */
+    bool setRootAttribute(const std::string &strName, const std::string &strValue,
+                          CXmlSerializingContext &serializingContext);
+
+    /** Build a child of the root element from a source, write it, then release it
+      *
+      * @param[in] xmlSource the source the child element is built from
+      * @param[in] strElementType the name of the child element
+      * @param[in,out] serializingContext is given to the source, and used as error output
+      *
+      * @return false if any error occurs
+      */
+    bool writeChild(const IXmlSource &xmlSource, const std::string &strElementType,
+                    CXmlSerializingContext &serializingContext);
+
+    /** Close the root element and flush the document to the output
+      *
+      * @return false if any error occurs
+      */
+    bool endDocument(CXmlSerializingContext &serializingContext);
+
+private:
+    /** Output buffer callbacks, forwarding to a std::ostream */
+    static int write(void *pOutput, const char *pcBuffer, int iLength);
+    static int close(void *pOutput);
+
+    bool checkWrite(int iStatus, CXmlSerializingContext &serializingContext);
+
+    /** Output buffer feeding _output, owned by _pWriter */
+    _xmlOutputBuffer *_pOutputBuffer;
+    _xmlTextWriter *_pWriter;
+
+    /** Whether the root element has children yet */
+    bool _bHasChildren{false};
+};